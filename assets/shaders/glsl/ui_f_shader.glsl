@@ -143,6 +143,16 @@ vec4 linegraph_color(vec2 tc) {
 	return vec4(inner_color, 1.0);
 }
 
+layout(index = 18) subroutine(font_function_class)
+vec4 atlas_sprite(vec2 tc) {
+	return texture(texture_sampler, vec2(tc.x * subrect.y + subrect.x, tc.y * subrect.a + subrect.z));
+}
+
+layout(index = 19) subroutine(font_function_class)
+vec4 atlas_use_mask(vec2 tc) {
+	return vec4(texture(texture_sampler, vec2(tc.x * subrect.y + subrect.x, tc.y * subrect.a + subrect.z)).rgb, texture(secondary_texture_sampler, tc).a);
+}
+
 void main() {
 	frag_color = gamma_correct(coloring_function(font_function(tex_coord)));
 }
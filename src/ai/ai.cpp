@@ -3058,7 +3058,7 @@ void make_war_decs(sys::state& state) {
 		if(state.world.nation_get_central_ports(n) > 0) {
 			// try some random coastal nations
 			for(uint32_t j = 0; j < 6; ++j) {
-				auto rvalue = rng::get_random(state, uint32_t((n.index() << 3) + j));
+				auto rvalue = rng::get_random(state, rng::stream::ai_war_targets, uint32_t(n.index()), j);
 				auto reduced_value = rng::reduce(uint32_t(rvalue), state.world.nation_size());
 				dcon::nation_id other{ dcon::nation_id::value_base_t(reduced_value) };
 				auto real_target = fatten(state.world, other).get_overlord_as_subject().get_ruler() ? fatten(state.world, other).get_overlord_as_subject().get_ruler() : fatten(state.world, other);
@@ -5266,6 +5266,8 @@ void general_ai_unit_tick(sys::state& state) {
 }
 
 float estimate_rebel_strength(sys::state& state, dcon::province_id p) {
+	if(military::army_count_in_province(state, p, dcon::nation_id{}) == 0)
+		return 0.f;
 	float v = 0.f;
 	for(auto ar : state.world.province_get_army_location(p))
 		if(ar.get_army().get_controller_from_army_rebel_control())
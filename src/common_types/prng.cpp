@@ -47,4 +47,27 @@ uint32_t reduce(uint32_t value_in, uint32_t upper_bound) {
 	return uint32_t((uint64_t(value_in) * uint64_t(upper_bound)) >> 32);
 }
 
+// stream draws use their own key, so they cannot collide with the keyed draws above
+uint64_t get_random(sys::state const& state, stream s, uint32_t entity, uint32_t draw) {
+	r123::Philox4x32 rng;
+	r123::Philox4x32::ctr_type c = {state.current_date.value, uint32_t(s), entity, draw };
+	r123::Philox4x32::key_type k = {state.game_seed, 0x6C2E91B5 };
+
+	r123::Philox4x32::ctr_type r = rng(c, k);
+
+	return (uint64_t(r[0]) << 32) | uint64_t(r[1]);
+}
+random_pair get_random_pair(sys::state const& state, stream s, uint32_t entity, uint32_t draw) {
+	r123::Philox4x32 rng;
+	r123::Philox4x32::ctr_type c = {state.current_date.value, uint32_t(s), entity, draw };
+	r123::Philox4x32::key_type k = {state.game_seed, 0x6C2E91B5 };
+
+	r123::Philox4x32::ctr_type r = rng(c, k);
+
+	return random_pair{(uint64_t(r[0]) << 32) | uint64_t(r[1]), (uint64_t(r[2]) << 32) | uint64_t(r[3])};
+}
+float to_unit_float(uint64_t value_in) {
+	return float(uint32_t(value_in >> 40)) / float(1 << 24);
+}
+
 } // namespace rng
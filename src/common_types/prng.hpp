@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 namespace sys {
 struct state;
 }
@@ -17,4 +19,17 @@ uint64_t get_random(sys::state const& state, uint32_t value_in_hi, uint32_t valu
 random_pair get_random_pair(sys::state const& state, uint32_t value_in_hi, uint32_t value_in_lo);
 uint32_t reduce(uint32_t value_in, uint32_t upper_bound);
 
+// Streams give each system its own space of random numbers. A draw is addressed by (stream, entity index, draw index) and the
+// current date, rather than by a hand-built key, so draws from different systems or entities never collide, and a stage
+// gets the same numbers whatever order or thread its entities are processed in.
+enum class stream : uint32_t {
+	invention_discovery = 1,
+	movement_joining = 2,
+	ai_war_targets = 3,
+};
+
+uint64_t get_random(sys::state const& state, stream s, uint32_t entity, uint32_t draw);
+random_pair get_random_pair(sys::state const& state, stream s, uint32_t entity, uint32_t draw);
+float to_unit_float(uint64_t value_in); // maps a random value to [0, 1)
+
 } // namespace rng
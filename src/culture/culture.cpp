@@ -955,15 +955,17 @@ void update_research(sys::state& state, uint32_t current_year) {
 					n.get_research_points() -= cost;
 					apply_technology(state, n, n.get_current_research());
 
-					notification::post(state, notification::message{
-						[t = n.get_current_research()](sys::state& state, text::layout_base& contents) {
-							text::add_line(state, contents, "msg_tech_1", text::variable_type::x, state.world.technology_get_name(t));
-							ui::technology_description(state, contents, t);
-						},
-						"msg_tech_title",
-						n, dcon::nation_id{}, dcon::nation_id{},
-						sys::message_base_type::tech
-					});
+					if(notification::is_wanted(state, sys::message_base_type::tech, n)) {
+						notification::post(state, notification::message{
+							[t = n.get_current_research()](sys::state& state, text::layout_base& contents) {
+								text::add_line(state, contents, "msg_tech_1", text::variable_type::x, state.world.technology_get_name(t));
+								ui::technology_description(state, contents, t);
+							},
+							"msg_tech_title",
+							n, dcon::nation_id{}, dcon::nation_id{},
+							sys::message_base_type::tech
+						});
+					}
 
 					n.set_current_research(dcon::technology_id{});
 				}
@@ -994,19 +996,21 @@ void discover_inventions(sys::state& state) {
 						: 1.f;
 					ve::apply([&](dcon::nation_id n, float chance, bool allow_discovery) {
 						if(allow_discovery) {
-							auto random = rng::get_random(state, uint32_t(inv.id.index()) << 5 ^ uint32_t(n.index()));
+							auto random = rng::get_random(state, rng::stream::invention_discovery, uint32_t(n.index()), uint32_t(inv.id.index()));
 							if(int32_t(random % 100) < int32_t(chance)) {
 								apply_invention(state, n, inv);
 
-								notification::post(state, notification::message{
-									[inv](sys::state& state, text::layout_base& contents) {
-										text::add_line(state, contents, "msg_inv_1", text::variable_type::x, state.world.invention_get_name(inv));
-										ui::invention_description(state, contents, inv, 0);
-									},
-									"msg_inv_title",
-									n, dcon::nation_id{}, dcon::nation_id{},
-									sys::message_base_type::invention
-								});
+								if(notification::is_wanted(state, sys::message_base_type::invention, n)) {
+									notification::post(state, notification::message{
+										[inv](sys::state& state, text::layout_base& contents) {
+											text::add_line(state, contents, "msg_inv_1", text::variable_type::x, state.world.invention_get_name(inv));
+											ui::invention_description(state, contents, inv, 0);
+										},
+										"msg_inv_title",
+										n, dcon::nation_id{}, dcon::nation_id{},
+										sys::message_base_type::invention
+									});
+								}
 							}
 						}
 					}, nids, chances, may_discover);
@@ -1022,19 +1026,21 @@ void discover_inventions(sys::state& state) {
 						: 1.f;
 					ve::apply([&](dcon::nation_id n, float chance, bool block_discovery) {
 						if(!block_discovery) {
-							auto random = rng::get_random(state, uint32_t(inv.id.index()) << 5 ^ uint32_t(n.index()));
+							auto random = rng::get_random(state, rng::stream::invention_discovery, uint32_t(n.index()), uint32_t(inv.id.index()));
 							if(int32_t(random % 100) < int32_t(chance)) {
 								apply_invention(state, n, inv);
 
-								notification::post(state, notification::message{
-									[inv](sys::state& state, text::layout_base& contents) {
-										text::add_line(state, contents, "msg_inv_1", text::variable_type::x, state.world.invention_get_name(inv));
-										ui::invention_description(state, contents, inv, 0);
-									},
-									"msg_inv_title",
-									n, dcon::nation_id{}, dcon::nation_id{},
-									sys::message_base_type::invention
-								});
+								if(notification::is_wanted(state, sys::message_base_type::invention, n)) {
+									notification::post(state, notification::message{
+										[inv](sys::state& state, text::layout_base& contents) {
+											text::add_line(state, contents, "msg_inv_1", text::variable_type::x, state.world.invention_get_name(inv));
+											ui::invention_description(state, contents, inv, 0);
+										},
+										"msg_inv_title",
+										n, dcon::nation_id{}, dcon::nation_id{},
+										sys::message_base_type::invention
+									});
+								}
 							}
 						}
 					}, nids, chances, may_not_discover);
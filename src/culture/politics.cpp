@@ -437,7 +437,8 @@ float pop_vote_weight(sys::state& state, dcon::pop_id p, dcon::nation_id n) {
 	}
 }
 
-void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
+// fills in the upper house of n; accumulated_in_state is scratch space for one float per ideology
+static void compute_upper_house(sys::state& state, dcon::nation_id n, float* accumulated_in_state) {
 	/*
 	Every year, the upper house of each nation is updated. If the "same as ruling party" rule is set, the upper house becomes 100%
 	the ideology of the ruling party. If the rule is "state vote", then for each non-colonial state: for each pop in the state
@@ -447,9 +448,6 @@ void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
 	just the rich ones for "rich only") is distributed proportionally to its ideological support, with the sum for all eligible
 	pops forming the distribution for the upper house.
 	*/
-	static std::vector<float> accumulated_in_state;
-	accumulated_in_state.resize(state.world.ideology_size());
-
 	auto rules = state.world.nation_get_combined_issue_rules(n);
 	auto allowed_ideo = state.world.nation_get_government_type(n).get_ideologies_allowed();
 	//(allowed_ideo & culture::to_bits(i)) != 0
@@ -587,7 +585,9 @@ void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
 				state.world.nation_set_upper_house(n, rp_ideology, 100.0f);
 		}
 	}
+}
 
+static void post_upper_house_message(sys::state& state, dcon::nation_id n) {
 	if(n == state.local_player_nation) {
 		notification::post(state, notification::message{
 			[n](sys::state& state, text::layout_base& contents) {
@@ -606,6 +606,30 @@ void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
 	}
 }
 
+void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
+	static std::vector<float> accumulated_in_state;
+	accumulated_in_state.resize(state.world.ideology_size());
+	compute_upper_house(state, n, accumulated_in_state.data());
+	post_upper_house_message(state, n);
+}
+
+void recalculate_upper_houses(sys::state& state) {
+	// each nation only writes its own upper house, so they can be computed side by side; every nation gets
+	// its own slice of the scratch buffer
+	static std::vector<float> scratch;
+	auto ideology_count = state.world.ideology_size();
+	scratch.resize(state.world.nation_size() * ideology_count);
+
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		dcon::nation_id n{dcon::nation_id::value_base_t(i)};
+		if(state.world.nation_is_valid(n) && state.world.nation_get_owned_province_count(n) != 0)
+			compute_upper_house(state, n, scratch.data() + size_t(i) * ideology_count);
+	});
+
+	if(state.local_player_nation && state.world.nation_get_owned_province_count(state.local_player_nation) != 0)
+		post_upper_house_message(state, state.local_player_nation);
+}
+
 void daily_party_loyalty_update(sys::state& state) {
 	province::for_each_land_province(state, [&](dcon::province_id p) {
 		auto si = state.world.province_get_state_membership(p);
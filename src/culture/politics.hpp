@@ -43,6 +43,7 @@ void change_government_type(sys::state& state, dcon::nation_id n, dcon::governme
 
 // this function sets the upper house (for example, as when performing the yearly upper house update)
 void recalculate_upper_house(sys::state& state, dcon::nation_id n);
+void recalculate_upper_houses(sys::state& state); // every nation with provinces, in parallel
 
 float party_total_support(sys::state& state, dcon::pop_id pop, dcon::political_party_id par_id, dcon::nation_id nat_id,
 		dcon::province_id prov_id);
@@ -193,6 +193,12 @@ bool movement_is_valid(sys::state& state, dcon::movement_id m) {
 
 void update_pop_movement_membership(sys::state& state) {
 	state.world.for_each_pop([&](dcon::pop_id p) {
+		// most pops are in no movement and can't join one, so get rid of them before looking anything else up
+		if(!state.world.pop_get_movement_from_pop_movement_membership(p)
+			&& state.world.pop_get_militancy(p) < state.defines.mil_to_join_rebel
+			&& state.world.pop_get_consciousness(p) < 1.5f && state.world.pop_get_literacy(p) < 0.25f)
+			return;
+
 		auto owner = nations::owner_of_pop(state, p);
 		// pops not in a nation can't be in a movement
 		if(!owner)
@@ -264,7 +270,7 @@ void update_pop_movement_membership(sys::state& state) {
 
 						// probability test
 						auto fp_prob = 9.0f * sup * (state.defines.movement_lit_factor * lit + state.defines.movement_con_factor * con);
-						auto rvalue = float(uint32_t(rng::get_random(state, (p.value << 3) ^ io.index()) & 0xFFFF)) / float(0x10000);
+						auto rvalue = float(uint32_t(rng::get_random(state, rng::stream::movement_joining, uint32_t(p.index()), uint32_t(io.index())) & 0xFFFF)) / float(0x10000);
 						if(rvalue < fp_prob) {
 
 							// is this issue possible to get by law?
@@ -441,187 +447,66 @@ bool pop_is_compatible_with_rebel_type(sys::state& state, dcon::pop_id p, dcon::
 	return true;
 }
 
-void update_pop_rebel_membership(sys::state& state) {
-	state.world.for_each_pop([&](dcon::pop_id p) {
-		auto owner = nations::owner_of_pop(state, p);
-		// pops not in a nation can't be in a rebel faction
-		if(!owner)
-			return;
+static void update_single_pop_rebel_membership(sys::state& state, dcon::pop_id p) {
+	auto owner = nations::owner_of_pop(state, p);
+	// pops not in a nation can't be in a rebel faction
+	if(!owner)
+		return;
 
-		auto mil = state.world.pop_get_militancy(p);
-		auto existing_faction = state.world.pop_get_rebel_faction_from_pop_rebellion_membership(p);
+	auto mil = state.world.pop_get_militancy(p);
+	auto existing_faction = state.world.pop_get_rebel_faction_from_pop_rebellion_membership(p);
 
-		// -Pops with define : MIL_TO_JOIN_REBEL will join a rebel_faction
-		if(mil >= state.defines.mil_to_join_rebel) {
-			if(existing_faction && !pop_is_compatible_with_rebel_faction(state, p, existing_faction)) {
-				remove_pop_from_rebel_faction(state, p);
+	// -Pops with define : MIL_TO_JOIN_REBEL will join a rebel_faction
+	if(mil >= state.defines.mil_to_join_rebel) {
+		if(existing_faction && !pop_is_compatible_with_rebel_faction(state, p, existing_faction)) {
+			remove_pop_from_rebel_faction(state, p);
+		} else {
+			auto prov = state.world.pop_get_province_from_pop_location(p);
+			/*
+			- A pop in a province sieged or controlled by rebels will join that faction, if the pop is compatible with the
+			faction.
+			*/
+
+			auto occupying_faction = state.world.province_get_rebel_faction_from_province_rebel_control(prov);
+			if(occupying_faction && pop_is_compatible_with_rebel_faction(state, p, occupying_faction)) {
+				assert(!bool(state.world.province_get_nation_from_province_control(prov)));
+				add_pop_to_rebel_faction(state, p, occupying_faction);
 			} else {
-				auto prov = state.world.pop_get_province_from_pop_location(p);
 				/*
-				- A pop in a province sieged or controlled by rebels will join that faction, if the pop is compatible with the
-				faction.
+				- Otherwise take all the compatible and possible rebel types. Determine the spawn chance for each of them, by
+				taking the *product* of the modifiers. The pop then joins the type with the greatest chance (that's right, it
+				isn't really a *chance* at all). If that type has a defection type, it joins the faction with the national
+				identity most compatible with it and that type (pan-nationalist go to the union tag, everyone else uses the
+				logic I outline below)
 				*/
-
-				auto occupying_faction = state.world.province_get_rebel_faction_from_province_rebel_control(prov);
-				if(occupying_faction && pop_is_compatible_with_rebel_faction(state, p, occupying_faction)) {
-					assert(!bool(state.world.province_get_nation_from_province_control(prov)));
-					add_pop_to_rebel_faction(state, p, occupying_faction);
-				} else {
-					/*
-					- Otherwise take all the compatible and possible rebel types. Determine the spawn chance for each of them, by
-					taking the *product* of the modifiers. The pop then joins the type with the greatest chance (that's right, it
-					isn't really a *chance* at all). If that type has a defection type, it joins the faction with the national
-					identity most compatible with it and that type (pan-nationalist go to the union tag, everyone else uses the
-					logic I outline below)
-					*/
-					float greatest_chance = 0.0f;
-					dcon::rebel_faction_id f;
-					for(auto rf : state.world.nation_get_rebellion_within(owner)) {
-						if(pop_is_compatible_with_rebel_faction(state, p, rf.get_rebels())) {
-							auto chance = rf.get_rebels().get_type().get_spawn_chance();
-							auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
-									trigger::to_generic(owner), trigger::to_generic(rf.get_rebels().id));
-							if(eval > greatest_chance) {
-								f = rf.get_rebels();
-								greatest_chance = eval;
-							}
+				float greatest_chance = 0.0f;
+				dcon::rebel_faction_id f;
+				for(auto rf : state.world.nation_get_rebellion_within(owner)) {
+					if(pop_is_compatible_with_rebel_faction(state, p, rf.get_rebels())) {
+						auto chance = rf.get_rebels().get_type().get_spawn_chance();
+						auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
+								trigger::to_generic(owner), trigger::to_generic(rf.get_rebels().id));
+						if(eval > greatest_chance) {
+							f = rf.get_rebels();
+							greatest_chance = eval;
 						}
 					}
+				}
 
-					dcon::rebel_faction_id temp = state.world.create_rebel_faction();
-					dcon::national_identity_id ind_tag = [&]() {
-						auto prov = state.world.pop_get_province_from_pop_location(p);
-						for(auto core : state.world.province_get_core(prov)) {
-							if(!core.get_identity().get_is_not_releasable() && core.get_identity().get_primary_culture() == state.world.pop_get_culture(p))
-								return core.get_identity().id;
-						}
-						return dcon::national_identity_id{};
-					}();
-
-					dcon::rebel_type_id max_type;
-
-					state.world.for_each_rebel_type([&](dcon::rebel_type_id rt) {
-						if(pop_is_compatible_with_rebel_type(state, p, rt)) {
-							state.world.rebel_faction_set_type(temp, rt);
-							state.world.rebel_faction_set_defection_target(temp, dcon::national_identity_id{});
-							state.world.rebel_faction_set_primary_culture(temp, dcon::culture_id{});
-							state.world.rebel_faction_set_primary_culture_group(temp, dcon::culture_group_id{});
-							state.world.rebel_faction_set_religion(temp, dcon::religion_id{});
-
-							switch(culture::rebel_defection(state.world.rebel_type_get_defection(rt))) {
-							case culture::rebel_defection::culture:
-								state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_defection::culture_group:
-								state.world.rebel_faction_set_primary_culture_group(temp,
-										state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_defection::religion:
-								state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_defection::pan_nationalist: {
-								auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
-								auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
-								if(!u)
-									return; // skip -- no pan nationalist possible
-								state.world.rebel_faction_set_defection_target(temp, u);
-								break;
-							}
-							case culture::rebel_defection::any:
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							default:
-								break;
-							}
-
-							switch(culture::rebel_independence(state.world.rebel_type_get_independence(rt))) {
-							case culture::rebel_independence::culture:
-								state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::culture_group:
-								state.world.rebel_faction_set_primary_culture_group(temp,
-										state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::religion:
-								state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::pan_nationalist: {
-								auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
-								auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
-								if(!u)
-									return; // skip -- no pan nationalist possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								state.world.rebel_faction_set_defection_target(temp, u);
-								break;
-							}
-							case culture::rebel_independence::any:
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::colonial:
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							default:
-								break;
-							}
+				dcon::rebel_faction_id temp = state.world.create_rebel_faction();
+				dcon::national_identity_id ind_tag = [&]() {
+					auto prov = state.world.pop_get_province_from_pop_location(p);
+					for(auto core : state.world.province_get_core(prov)) {
+						if(!core.get_identity().get_is_not_releasable() && core.get_identity().get_primary_culture() == state.world.pop_get_culture(p))
+							return core.get_identity().id;
+					}
+					return dcon::national_identity_id{};
+				}();
 
-							auto chance = state.world.rebel_type_get_spawn_chance(rt);
-							auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
-									trigger::to_generic(owner), trigger::to_generic(temp));
-							if(eval > greatest_chance) {
-								f = temp;
-								max_type = rt;
-								greatest_chance = eval;
-							}
-						}
-					});
+				dcon::rebel_type_id max_type;
 
-					if(f != temp) {
-						state.world.delete_rebel_faction(temp);
-					} else {
-						auto rt = max_type;
+				state.world.for_each_rebel_type([&](dcon::rebel_type_id rt) {
+					if(pop_is_compatible_with_rebel_type(state, p, rt)) {
 						state.world.rebel_faction_set_type(temp, rt);
 						state.world.rebel_faction_set_defection_target(temp, dcon::national_identity_id{});
 						state.world.rebel_faction_set_primary_culture(temp, dcon::culture_id{});
@@ -632,24 +517,42 @@ void update_pop_rebel_membership(sys::state& state) {
 						case culture::rebel_defection::culture:
 							state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						case culture::rebel_defection::culture_group:
 							state.world.rebel_faction_set_primary_culture_group(temp,
 									state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						case culture::rebel_defection::religion:
 							state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						case culture::rebel_defection::pan_nationalist: {
 							auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
 							auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
+							if(!u)
+								return; // skip -- no pan nationalist possible
 							state.world.rebel_faction_set_defection_target(temp, u);
 							break;
 						}
 						case culture::rebel_defection::any:
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						default:
 							break;
@@ -659,52 +562,164 @@ void update_pop_rebel_membership(sys::state& state) {
 						case culture::rebel_independence::culture:
 							state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						case culture::rebel_independence::culture_group:
 							state.world.rebel_faction_set_primary_culture_group(temp,
 									state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						case culture::rebel_independence::religion:
 							state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						case culture::rebel_independence::pan_nationalist: {
 							auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
 							auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
+							if(!u)
+								return; // skip -- no pan nationalist possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							state.world.rebel_faction_set_defection_target(temp, u);
 							break;
 						}
 						case culture::rebel_independence::any:
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						case culture::rebel_independence::colonial:
 							state.world.rebel_faction_set_defection_target(temp, ind_tag);
+							if(!ind_tag)
+								return; // skip -- no defection possible
+							if(state.world.pop_get_is_primary_or_accepted_culture(p))
+								return; // skip -- can't defect
 							break;
 						default:
 							break;
 						}
 
-						if(state.world.rebel_type_get_culture_restriction(rt) && !state.world.rebel_faction_get_primary_culture(temp)) {
-							state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-						}
-						if(state.world.rebel_type_get_culture_group_restriction(rt) && !state.world.rebel_faction_get_primary_culture_group(temp)) {
-							state.world.rebel_faction_set_primary_culture_group(temp, state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
+						auto chance = state.world.rebel_type_get_spawn_chance(rt);
+						auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
+								trigger::to_generic(owner), trigger::to_generic(temp));
+						if(eval > greatest_chance) {
+							f = temp;
+							max_type = rt;
+							greatest_chance = eval;
 						}
+					}
+				});
+
+				if(f != temp) {
+					state.world.delete_rebel_faction(temp);
+				} else {
+					auto rt = max_type;
+					state.world.rebel_faction_set_type(temp, rt);
+					state.world.rebel_faction_set_defection_target(temp, dcon::national_identity_id{});
+					state.world.rebel_faction_set_primary_culture(temp, dcon::culture_id{});
+					state.world.rebel_faction_set_primary_culture_group(temp, dcon::culture_group_id{});
+					state.world.rebel_faction_set_religion(temp, dcon::religion_id{});
+
+					switch(culture::rebel_defection(state.world.rebel_type_get_defection(rt))) {
+					case culture::rebel_defection::culture:
+						state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					case culture::rebel_defection::culture_group:
+						state.world.rebel_faction_set_primary_culture_group(temp,
+								state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					case culture::rebel_defection::religion:
+						state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					case culture::rebel_defection::pan_nationalist: {
+						auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
+						auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
+						state.world.rebel_faction_set_defection_target(temp, u);
+						break;
+					}
+					case culture::rebel_defection::any:
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					default:
+						break;
+					}
 
-						state.world.try_create_rebellion_within(temp, owner);
+					switch(culture::rebel_independence(state.world.rebel_type_get_independence(rt))) {
+					case culture::rebel_independence::culture:
+						state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					case culture::rebel_independence::culture_group:
+						state.world.rebel_faction_set_primary_culture_group(temp,
+								state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					case culture::rebel_independence::religion:
+						state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					case culture::rebel_independence::pan_nationalist: {
+						auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
+						auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
+						state.world.rebel_faction_set_defection_target(temp, u);
+						break;
+					}
+					case culture::rebel_independence::any:
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					case culture::rebel_independence::colonial:
+						state.world.rebel_faction_set_defection_target(temp, ind_tag);
+						break;
+					default:
+						break;
 					}
 
-					if(greatest_chance > 0) {
-						add_pop_to_rebel_faction(state, p, f);
+					if(state.world.rebel_type_get_culture_restriction(rt) && !state.world.rebel_faction_get_primary_culture(temp)) {
+						state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
+					}
+					if(state.world.rebel_type_get_culture_group_restriction(rt) && !state.world.rebel_faction_get_primary_culture_group(temp)) {
+						state.world.rebel_faction_set_primary_culture_group(temp, state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
 					}
+
+					state.world.try_create_rebellion_within(temp, owner);
+				}
+
+				if(greatest_chance > 0) {
+					add_pop_to_rebel_faction(state, p, f);
 				}
 			}
-		} else { // less than: MIL_TO_JOIN_REBEL will join a rebel_faction -- leave faction
-			if(existing_faction) {
-				remove_pop_from_rebel_faction(state, p);
-			}
 		}
+	} else { // less than: MIL_TO_JOIN_REBEL will join a rebel_faction -- leave faction
+		if(existing_faction) {
+			remove_pop_from_rebel_faction(state, p);
+		}
+	}
+}
+
+void update_pop_rebel_membership(sys::state& state) {
+	state.world.for_each_pop([&](dcon::pop_id p) {
+		// a pop below the joining threshold and in no faction goes through update_single_pop_rebel_membership without
+		// changing anything, and most pops are like that, so skip them before the owner lookup
+		if(state.world.pop_get_militancy(p) < state.defines.mil_to_join_rebel
+			&& !state.world.pop_get_rebel_faction_from_pop_rebellion_membership(p))
+			return;
+		update_single_pop_rebel_membership(state, p);
 	});
 }
 
@@ -734,16 +749,6 @@ void update_factions(sys::state& state) {
 inline constexpr float org_gain_factor = 0.4f;
 
 void daily_update_rebel_organization(sys::state& state) {
-	// update brigade count
-	state.world.for_each_rebel_faction([&](dcon::rebel_faction_id rf) {
-		int32_t total = 0;
-		for(auto pop : state.world.rebel_faction_get_pop_rebellion_membership(rf)) {
-			total += int32_t(state.world.pop_get_size(pop.get_pop()) / state.defines.pop_size_per_regiment);
-		}
-		state.world.rebel_faction_set_possible_regiments(rf, total);
-	});
-
-	// update org
 	state.world.for_each_rebel_faction([&](dcon::rebel_faction_id rf) {
 		/*
 		- Sum for each pop belonging to the faction that has made money in the day: (pop-income + 0.02) x pop-literacy x (10 if
@@ -753,8 +758,12 @@ void daily_update_rebel_organization(sys::state& state) {
 		rebel faction (to a maximum of 1). This appears to be done daily.
 		*/
 
+		// the brigade count is refreshed in the same pass over the members, as pop sizes drift from the
+		// amounts added in add_pop_to_rebel_faction
+		int32_t total = 0;
 		float total_change = 0;
 		for(auto pop : state.world.rebel_faction_get_pop_rebellion_membership(rf)) {
+			total += int32_t(pop.get_pop().get_size() / state.defines.pop_size_per_regiment);
 			auto mil_factor = [&]() {
 				auto m = pop.get_pop().get_militancy();
 				if(m > state.defines.mil_to_autorise)
@@ -765,7 +774,8 @@ void daily_update_rebel_organization(sys::state& state) {
 			}();
 			total_change += pop.get_pop().get_savings() * pop.get_pop().get_literacy() * mil_factor * org_gain_factor;
 		}
-		auto reg_count = state.world.rebel_faction_get_possible_regiments(rf);
+		state.world.rebel_faction_set_possible_regiments(rf, total);
+		auto reg_count = total;
 		auto within = state.world.rebel_faction_get_ruler_from_rebellion_within(rf);
 		auto rebel_org_mod = 1.0f + state.world.nation_get_rebel_org_modifier(within, state.world.rebel_faction_get_type(rf));
 
@@ -944,7 +954,7 @@ void rebel_risings_check(sys::state& state) {
 							}
 							auto new_army = fatten(state.world, state.world.create_army());
 							new_army.set_controller_from_army_rebel_control(rf);
-							new_army.set_location_from_army_location(pop_location);
+							military::set_army_location(state, new_army, pop_location);
 							new_armies.push_back(new_army);
 							return new_army.id;
 						}();
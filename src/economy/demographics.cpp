@@ -761,7 +761,7 @@ void update_militancy(sys::state& state, uint32_t offset, uint32_t divisions) {
 
 	auto const conservatism_key = pop_demographics::to_key(state, state.culture_definitions.conservative);
 
-	execute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
+	pexecute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
 		auto loc = state.world.pop_get_province_from_pop_location(ids);
 		auto owner = state.world.province_get_nation_from_province_ownership(loc);
 		auto ruling_party = state.world.nation_get_ruling_party(owner);
@@ -872,7 +872,7 @@ void update_consciousness(sys::state& state, uint32_t offset, uint32_t divisions
 
 	auto const clergy_key = demographics::to_key(state, state.culture_definitions.clergy);
 
-	execute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
+	pexecute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
 		auto loc = state.world.pop_get_province_from_pop_location(ids);
 		auto owner = state.world.province_get_nation_from_province_ownership(loc);
 		auto cfrac =
@@ -965,7 +965,7 @@ void update_literacy(sys::state& state, uint32_t offset, uint32_t divisions) {
 
 	auto const clergy_key = demographics::to_key(state, state.culture_definitions.clergy);
 
-	execute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
+	pexecute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
 		auto loc = state.world.pop_get_province_from_pop_location(ids);
 		auto owner = state.world.province_get_nation_from_province_ownership(loc);
 		auto cfrac =
@@ -1215,7 +1215,7 @@ void update_growth(sys::state& state, uint32_t offset, uint32_t divisions) {
 	size to determine how much the pop grows by (growth is computed and applied during the pop's monthly tick).
 	*/
 
-	execute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
+	pexecute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
 		auto loc = state.world.pop_get_province_from_pop_location(ids);
 		auto owner = state.world.province_get_nation_from_province_ownership(loc);
 
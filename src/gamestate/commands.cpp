@@ -3841,7 +3841,7 @@ void execute_evenly_split_army(sys::state& state, dcon::nation_id source, dcon::
 	if(to_transfer.size() > 0) {
 		auto new_u = fatten(state.world, state.world.create_army());
 		new_u.set_controller_from_army_control(source);
-		new_u.set_location_from_army_location(state.world.army_get_location_from_army_location(a));
+		military::set_army_location(state, new_u, state.world.army_get_location_from_army_location(a));
 		new_u.set_black_flag(state.world.army_get_black_flag(a));
 
 		for(auto t : to_transfer) {
@@ -3932,7 +3932,7 @@ void execute_split_army(sys::state& state, dcon::nation_id source, dcon::army_id
 	if(to_transfer.size() > 0) {
 		auto new_u = fatten(state.world, state.world.create_army());
 		new_u.set_controller_from_army_control(source);
-		new_u.set_location_from_army_location(state.world.army_get_location_from_army_location(a));
+		military::set_army_location(state, new_u, state.world.army_get_location_from_army_location(a));
 		new_u.set_black_flag(state.world.army_get_black_flag(a));
 
 		for(auto t : to_transfer) {
@@ -5586,6 +5586,7 @@ void execute_command(sys::state& state, payload& c) {
 		execute_c_always_potential_decisions(state, c.source);
 		break;
 	}
+	trigger::invalidate_cached_results();
 }
 
 void execute_pending_commands(sys::state& state) {
@@ -3,12 +3,29 @@
 
 namespace notification {
 
+static uint8_t settings_bits_for_nation(sys::state& state, sys::message_setting_type t, dcon::nation_id n) {
+	if(t == sys::message_setting_type::count)
+		return 0;
+	if(n == state.local_player_nation)
+		return state.user_settings.self_message_settings[int32_t(t)];
+	else if(nation_is_interesting(state, n))
+		return state.user_settings.interesting_message_settings[int32_t(t)];
+	else
+		return state.user_settings.other_message_settings[int32_t(t)];
+}
+
+uint8_t settings_bits_for(sys::state& state, sys::message_base_type type, dcon::nation_id source, dcon::nation_id target, dcon::nation_id third) {
+	auto setting_types = sys::message_setting_map[int32_t(type)];
+	return settings_bits_for_nation(state, setting_types.source, source)
+		| settings_bits_for_nation(state, setting_types.target, target)
+		| settings_bits_for_nation(state, setting_types.third, third);
+}
+
 void post(sys::state& state, message&& m) {
-	//
-	// TODO: pre filter out any messages that the player is not interested in at all according to their message settings.
-	// But, probably don't try to fiter out by "interesting" except for considering whether the player nation is itself involved
-	// as that will probably be a more computationally expensive check
-	//
+	// messages that the player's settings would neither log, pop up nor play a sound for never reach the ui thread
+	m.settings_bits = settings_bits_for(state, m.type, m.source, m.target, m.third);
+	if(m.settings_bits == 0)
+		return;
 
 	bool v = state.new_messages.try_emplace(std::move(m));
 	assert(v);
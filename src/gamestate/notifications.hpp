@@ -12,9 +12,16 @@ struct message {
 	dcon::nation_id target;	 // which nation is primarily affected by the event (if != source)
 	dcon::nation_id third;	 // a secondary nation affected by the event
 	sys::message_base_type type;
+	uint8_t settings_bits = 0; // the message_response bits it was posted with, filled in by post
 };
 
 void post(sys::state& state, message&& m);
 bool nation_is_interesting(sys::state& state, dcon::nation_id n);
+// the message_response bits the local player's message settings give to a message of this type with these nations involved
+uint8_t settings_bits_for(sys::state& state, sys::message_base_type type, dcon::nation_id source, dcon::nation_id target, dcon::nation_id third);
+// lets busy call sites skip building a message body that post would throw away
+inline bool is_wanted(sys::state& state, sys::message_base_type type, dcon::nation_id source, dcon::nation_id target = dcon::nation_id{}, dcon::nation_id third = dcon::nation_id{}) {
+	return settings_bits_for(state, type, source, target, third) != 0;
+}
 
 } // namespace notification
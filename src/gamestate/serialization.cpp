@@ -293,6 +293,7 @@ uint8_t const* read_scenario_section(uint8_t const* ptr_in, uint8_t const* secti
 	ptr_in = memcpy_deserialize(ptr_in, state.start_date);
 	ptr_in = memcpy_deserialize(ptr_in, state.end_date);
 	ptr_in = deserialize(ptr_in, state.trigger_data);
+	ptr_in = deserialize(ptr_in, state.trigger_evaluation_data);
 	ptr_in = deserialize(ptr_in, state.trigger_data_indices);
 	ptr_in = deserialize(ptr_in, state.effect_data);
 	ptr_in = deserialize(ptr_in, state.effect_data_indices);
@@ -476,6 +477,7 @@ uint8_t* write_scenario_section(uint8_t* ptr_in, sys::state& state) {
 	ptr_in = memcpy_serialize(ptr_in, state.start_date);
 	ptr_in = memcpy_serialize(ptr_in, state.end_date);
 	ptr_in = serialize(ptr_in, state.trigger_data);
+	ptr_in = serialize(ptr_in, state.trigger_evaluation_data);
 	ptr_in = serialize(ptr_in, state.trigger_data_indices);
 	ptr_in = serialize(ptr_in, state.effect_data);
 	ptr_in = serialize(ptr_in, state.effect_data_indices);
@@ -653,6 +655,7 @@ scenario_size sizeof_scenario_section(sys::state& state) {
 	sz += sizeof(state.start_date);
 	sz += sizeof(state.end_date);
 	sz += serialize_size(state.trigger_data);
+	sz += serialize_size(state.trigger_evaluation_data);
 	sz += serialize_size(state.trigger_data_indices);
 	sz += serialize_size(state.effect_data);
 	sz += serialize_size(state.effect_data_indices);
@@ -998,6 +1001,118 @@ std::string make_time_string(uint64_t value) {
 	return result;
 }
 
+checksum_key update_save_checksum(sys::state& state, save_checksum_tree& tree) {
+	std::lock_guard lock{tree.update_lock};
+
+	dcon::load_record loaded = state.world.make_serialize_record_store_save();
+	tree.buffer.resize(state.world.serialize_size(loaded));
+	std::byte* start = reinterpret_cast<std::byte*>(tree.buffer.data());
+	std::byte* position = start;
+	state.world.serialize(position, loaded);
+
+	auto& new_columns = tree.new_columns;
+	new_columns.clear();
+	uint32_t total_segments = 0;
+	dcon::for_each_record(start, position, [&](dcon::record_header const& header, std::byte const* data_start, std::byte const* data_end) {
+		auto& c = new_columns.emplace_back();
+		c.name = std::string(header.object_name_start, header.object_name_end) + "." + std::string(header.property_name_start, header.property_name_end);
+		c.offset = size_t(data_start - start);
+		c.size = size_t(data_end - data_start);
+		c.first_segment = total_segments;
+		total_segments += uint32_t((c.size + save_checksum_tree::segment_size - 1) / save_checksum_tree::segment_size);
+	});
+
+	// a column can reuse the hashes from the last check if it sits at the same position in the record list and
+	// kept its size; a segment of it then keeps its hash when the fingerprint didn't change
+	auto& previous_column = tree.previous_column;
+	previous_column.resize(new_columns.size());
+	for(size_t i = 0; i < new_columns.size(); ++i) {
+		previous_column[i] = (i < tree.columns.size() && tree.columns[i].size == new_columns[i].size && tree.columns[i].name == new_columns[i].name) ? int32_t(i) : -1;
+	}
+
+	auto& new_segments = tree.new_segments;
+	auto& new_fingerprints = tree.new_fingerprints;
+	auto& segment_column = tree.segment_column;
+	new_segments.resize(total_segments);
+	new_fingerprints.resize(total_segments);
+	segment_column.resize(total_segments);
+	for(uint32_t i = 0; i < uint32_t(new_columns.size()); ++i) {
+		auto end = i + 1 < uint32_t(new_columns.size()) ? new_columns[i + 1].first_segment : total_segments;
+		for(uint32_t j = new_columns[i].first_segment; j < end; ++j)
+			segment_column[j] = i;
+	}
+
+	concurrency::parallel_for(uint32_t(0), total_segments, [&](uint32_t seg) {
+		auto& c = new_columns[segment_column[seg]];
+		auto local_index = seg - c.first_segment;
+		auto seg_offset = local_index * save_checksum_tree::segment_size;
+		auto seg_size = std::min(save_checksum_tree::segment_size, c.size - seg_offset);
+		auto data = tree.buffer.data() + c.offset + seg_offset;
+
+		new_fingerprints[seg] = ankerl::unordered_dense::detail::wyhash::hash(data, seg_size);
+		if(auto pc = previous_column[segment_column[seg]]; pc != -1) {
+			auto old_seg = tree.columns[pc].first_segment + local_index;
+			if(tree.segment_fingerprints[old_seg] == new_fingerprints[seg]) {
+				new_segments[seg] = tree.segment_hashes[old_seg];
+				return;
+			}
+		}
+		blake2b(&new_segments[seg], sizeof(checksum_key), data, seg_size, nullptr, 0);
+	});
+
+	auto& column_data = tree.column_data;
+	for(auto& c : new_columns) {
+		auto count = uint32_t((c.size + save_checksum_tree::segment_size - 1) / save_checksum_tree::segment_size);
+		column_data.resize(sizeof(uint64_t) + count * sizeof(checksum_key));
+		uint64_t size = c.size;
+		std::memcpy(column_data.data(), &size, sizeof(uint64_t));
+		if(count > 0)
+			std::memcpy(column_data.data() + sizeof(uint64_t), new_segments.data() + c.first_segment, count * sizeof(checksum_key));
+		blake2b(&c.hash, sizeof(checksum_key), column_data.data(), column_data.size(), nullptr, 0);
+	}
+
+	column_data.clear();
+	for(auto& c : new_columns) {
+		column_data.insert(column_data.end(), c.name.begin(), c.name.end());
+		column_data.insert(column_data.end(), c.hash.key, c.hash.key + checksum_key::key_size);
+	}
+	checksum_key key;
+	blake2b(&key, sizeof(key), column_data.data(), column_data.size(), nullptr, 0);
+
+	std::swap(tree.columns, new_columns);
+	std::swap(tree.segment_hashes, new_segments);
+	std::swap(tree.segment_fingerprints, new_fingerprints);
+	return key;
+}
+
+void write_save_checksum_report(save_checksum_tree& tree, simple_fs::directory const& dir, native_string_view file_name) {
+	std::lock_guard lock{tree.update_lock};
+
+	auto to_hex = [](checksum_key const& k, std::string& out) {
+		constexpr char digits[] = "0123456789abcdef";
+		for(uint32_t i = 0; i < 16; ++i) { // a prefix is plenty to tell segments apart
+			out += digits[k.key[i] >> 4];
+			out += digits[k.key[i] & 0x0F];
+		}
+	};
+
+	std::string out;
+	for(auto& c : tree.columns) {
+		out += c.name;
+		out += " size=" + std::to_string(c.size) + " ";
+		to_hex(c.hash, out);
+		out += "\n";
+		auto count = uint32_t((c.size + save_checksum_tree::segment_size - 1) / save_checksum_tree::segment_size);
+		for(uint32_t i = 0; i < count; ++i) {
+			auto begin = size_t(i) * save_checksum_tree::segment_size;
+			out += "\t[" + std::to_string(begin) + ", " + std::to_string(std::min(begin + save_checksum_tree::segment_size, c.size)) + ") ";
+			to_hex(tree.segment_hashes[c.first_segment + i], out);
+			out += "\n";
+		}
+	}
+	simple_fs::write_file(dir, file_name, out.data(), uint32_t(out.size()));
+}
+
 void write_save_file(sys::state& state, save_type type, std::string const& name) {
 	save_header header;
 	header.count = state.scenario_counter;
@@ -1,5 +1,7 @@
 #pragma once
 #include <vector>
+#include <string>
+#include <mutex>
 #include "container_types.hpp"
 #include "unordered_dense.h"
 #include "text.hpp"
@@ -152,7 +154,7 @@ inline uint8_t const* deserialize(uint8_t const* ptr_in, ankerl::unordered_dense
 }
 
 constexpr inline uint32_t save_file_version = 39;
-constexpr inline uint32_t scenario_file_version = 130 + save_file_version;
+constexpr inline uint32_t scenario_file_version = 132 + save_file_version;
 
 struct scenario_header {
 	uint32_t version = scenario_file_version;
@@ -211,6 +213,42 @@ bool try_read_scenario_file(sys::state& state, native_string_view name);
 bool try_read_scenario_and_save_file(sys::state& state, native_string_view name);
 bool try_read_scenario_as_save_file(sys::state& state, native_string_view name);
 
+/*
+The multiplayer checksum is computed over the serialized save record store, but instead of hashing the whole buffer
+every time, each dcon record (one object.property column) is cut into fixed size segments and hashed separately.
+Every segment gets a cheap 64 bit fingerprint; a segment is only run through blake2b again when its fingerprint
+differs from the one of the previous check. Segment hashes are combined into a hash per column, and the column hashes
+into the final key.
+*/
+struct checksum_column {
+	std::string name; // object.property
+	size_t offset = 0; // of the record data in the serialized buffer
+	size_t size = 0;
+	uint32_t first_segment = 0;
+	checksum_key hash;
+};
+struct save_checksum_tree {
+	static constexpr size_t segment_size = 64 * 1024;
+
+	std::vector<checksum_column> columns;
+	std::vector<checksum_key> segment_hashes;
+	std::vector<uint64_t> segment_fingerprints;
+
+	// scratch, reused between checks
+	std::vector<uint8_t> buffer;
+	std::vector<checksum_column> new_columns;
+	std::vector<int32_t> previous_column;
+	std::vector<checksum_key> new_segments;
+	std::vector<uint64_t> new_fingerprints;
+	std::vector<uint32_t> segment_column;
+	std::vector<uint8_t> column_data;
+
+	std::mutex update_lock;
+};
+checksum_key update_save_checksum(sys::state& state, save_checksum_tree& tree);
+// writes one line per column and segment so that the reports of two players can be diffed directly
+void write_save_checksum_report(save_checksum_tree& tree, simple_fs::directory const& dir, native_string_view file_name);
+
 void write_save_file(sys::state& state, sys::save_type type = sys::save_type::normal, std::string const& name = std::string(""));
 bool try_read_save_file(sys::state& state, native_string_view name);
 
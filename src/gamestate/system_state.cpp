@@ -37,6 +37,7 @@
 #include "gui_map_legend.hpp"
 #include "gui_unit_grid_box.hpp"
 #include "blake2.h"
+#include "serialization.hpp"
 
 namespace ui {
 void create_in_game_windows(sys::state& state) {
@@ -232,6 +233,13 @@ void create_in_game_windows(sys::state& state) {
 
 namespace sys {
 
+state::state() : untrans_key_to_text_sequence(0, text::vector_backed_ci_hash(key_data), text::vector_backed_ci_eq(key_data)), locale_key_to_text_sequence(0, text::vector_backed_ci_hash(key_data), text::vector_backed_ci_eq(key_data)), save_checksums(std::make_unique<sys::save_checksum_tree>()), incoming_commands(1024), new_n_event(1024), new_f_n_event(1024), new_p_event(1024), new_f_p_event(1024), new_requests(256), new_messages(2048), naval_battle_reports(256), land_battle_reports(256) {
+
+	key_data.push_back(0);
+}
+
+state::~state() = default;
+
 void state::start_state_selection(state_selection_data& data) {
 	mode = sys::game_mode_type::select_states;
 	if(state_selection) {
@@ -812,6 +820,7 @@ void state::render() { // called to render the frame may (and should) delay retu
 	if(game_state_was_updated) {
 		map_state.map_data.update_fog_of_war(*this);
 	}
+	ogl::upload_streamed_textures(*this);
 
 	std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
 	if(ui_state.last_render_time == std::chrono::time_point<std::chrono::steady_clock>{}) {
@@ -1053,35 +1062,7 @@ void state::render() { // called to render the frame may (and should) delay retu
 			auto* c6 = new_messages.front();
 			while(c6) {
 				auto base_type = c6->type;
-				auto setting_types = sys::message_setting_map[int32_t(base_type)];
-				uint8_t settings_bits = 0;
-				if(setting_types.source != sys::message_setting_type::count) {
-					if(c6->source == local_player_nation) {
-						settings_bits |= user_settings.self_message_settings[int32_t(setting_types.source)];
-					} else if(notification::nation_is_interesting(*this, c6->source)) {
-						settings_bits |= user_settings.interesting_message_settings[int32_t(setting_types.source)];
-					} else {
-						settings_bits |= user_settings.other_message_settings[int32_t(setting_types.source)];
-					}
-				}
-				if(setting_types.target != sys::message_setting_type::count) {
-					if(c6->target == local_player_nation) {
-						settings_bits |= user_settings.self_message_settings[int32_t(setting_types.target)];
-					} else if(notification::nation_is_interesting(*this, c6->target)) {
-						settings_bits |= user_settings.interesting_message_settings[int32_t(setting_types.target)];
-					} else {
-						settings_bits |= user_settings.other_message_settings[int32_t(setting_types.target)];
-					}
-				}
-				if(setting_types.third != sys::message_setting_type::count) {
-					if(c6->third == local_player_nation) {
-						settings_bits |= user_settings.self_message_settings[int32_t(setting_types.third)];
-					} else if(notification::nation_is_interesting(*this, c6->third)) {
-						settings_bits |= user_settings.interesting_message_settings[int32_t(setting_types.third)];
-					} else {
-						settings_bits |= user_settings.other_message_settings[int32_t(setting_types.third)];
-					}
-				}
+				auto settings_bits = c6->settings_bits;
 
 				if((settings_bits & message_response::log) && ui_state.msg_log_window) {
 					static_cast<ui::message_log_window*>(ui_state.msg_log_window)->messages.push_back(*c6);
@@ -1191,7 +1172,9 @@ void state::render() { // called to render the frame may (and should) delay retu
 				ui_state.root->move_child_to_front(ui_state.msg_window);
 			}
 		}
+		ui_state.refreshing_for_game_state = true;
 		root_elm->impl_on_update(*this);
+		ui_state.refreshing_for_game_state = false;
 		if(mode != sys::game_mode_type::pick_nation && mode != sys::game_mode_type::end_screen) {
 			map_mode::update_map_mode(*this);
 			if(ui_state.unit_details_box && ui_state.unit_details_box->is_visible()) {
@@ -1638,26 +1621,12 @@ std::string_view state::to_string_view(dcon::text_key tag) const {
 	if(!tag)
 		return std::string_view();
 	assert(size_t(tag.index()) < key_data.size());
-	auto start_position = key_data.data() + tag.index();
-	auto data_size = key_data.size();
-	auto end_position = start_position;
-	for(; end_position < key_data.data() + data_size; ++end_position) {
-		if(*end_position == 0)
-			break;
-	}
-	return std::string_view(key_data.data() + tag.index(), size_t(end_position - start_position));
+	return text::pooled_string_view(key_data, uint32_t(tag.index()));
 }
 
 std::string_view state::locale_string_view(uint32_t tag) const {
 	assert(size_t(tag) < locale_text_data.size());
-	auto start_position = locale_text_data.data() + tag;
-	auto data_size = locale_text_data.size();
-	auto end_position = start_position;
-	for(; end_position < locale_text_data.data() + data_size; ++end_position) {
-		if(*end_position == 0)
-			break;
-	}
-	return std::string_view(locale_text_data.data() + tag, size_t(end_position - start_position));
+	return text::pooled_string_view(locale_text_data, tag);
 }
 
 void state::reset_locale_pool() {
@@ -1770,13 +1739,9 @@ dcon::text_key state::add_key_utf8(std::string_view new_text) {
 	if(ekey)
 		return ekey;
 
-	auto start = key_data.size();
-	auto length = new_text.length();
-	if(length == 0)
+	if(new_text.length() == 0)
 		return dcon::text_key();
-	key_data.resize(start + length + 1, char(0));
-	std::copy_n(new_text.data(), length, key_data.data() + start);
-	key_data.back() = 0;
+	auto start = text::add_to_pool(key_data, new_text);
 
 	auto ret = dcon::text_key(dcon::text_key::value_base_t(start));
 	untrans_key_to_text_sequence.insert(ret);
@@ -1786,6 +1751,9 @@ uint32_t state::add_locale_data_win1252(std::string const& text) {
 	return add_locale_data_win1252(std::string_view(text));
 }
 uint32_t state::add_locale_data_win1252(std::string_view text) {
+	if(text.length() == 0)
+		return 0;
+	locale_text_data.resize(locale_text_data.size() + sizeof(uint32_t), char(0)); // length, filled in below
 	auto start = locale_text_data.size();
 	for(auto c : text) {
 		auto unicode = text::win1250toUTF16(c);
@@ -1802,6 +1770,8 @@ uint32_t state::add_locale_data_win1252(std::string_view text) {
 			locale_text_data.push_back(char(0x80 | uint8_t(0x3F & unicode)));
 		}
 	}
+	auto length = uint32_t(locale_text_data.size() - start);
+	std::memcpy(locale_text_data.data() + start - sizeof(uint32_t), &length, sizeof(uint32_t));
 	locale_text_data.push_back(0);
 	return uint32_t(start);
 }
@@ -1809,14 +1779,7 @@ uint32_t state::add_locale_data_utf8(std::string const& new_text) {
 	return add_locale_data_utf8(std::string_view(new_text));
 }
 uint32_t state::add_locale_data_utf8(std::string_view new_text) {
-	auto start = locale_text_data.size();
-	auto length = new_text.length();
-	if(length == 0)
-		return 0;
-	locale_text_data.resize(start + length + 1, char(0));
-	std::copy_n(new_text.data(), length, locale_text_data.data() + start);
-	locale_text_data.back() = 0;
-	return uint32_t(start);
+	return text::add_to_pool(locale_text_data, new_text);
 }
 
 dcon::unit_name_id state::add_unit_name(std::string_view text) {
@@ -1866,14 +1829,24 @@ dcon::trigger_key state::commit_trigger_data(std::vector<uint16_t> data) {
 	if(trigger_data_indices.empty()) { // Create placeholder for invalid triggers
 		trigger_data_indices.push_back(0);
 		trigger_data.push_back(uint16_t(trigger::always | trigger::no_payload | trigger::association_ne));
+		trigger_evaluation_data.push_back(uint16_t(trigger::always | trigger::no_payload | trigger::association_ne));
 	}
 
 	if(data.empty()) {
 		return dcon::trigger_key();
 	}
 
-	auto search_result = std::search(trigger_data.data() + 1, trigger_data.data() + trigger_data.size(),
-			std::boyer_moore_horspool_searcher(data.data(), data.data() + data.size()));
+	auto evaluation_data = data;
+	trigger::order_members_by_cost(evaluation_data.data());
+
+	// a match inside of another trigger can only be shared if the evaluation copy also matches there: the members
+	// of the enclosing trigger may have been moved around in it
+	auto const searcher = std::boyer_moore_horspool_searcher(data.data(), data.data() + data.size());
+	auto search_result = std::search(trigger_data.data() + 1, trigger_data.data() + trigger_data.size(), searcher);
+	while(search_result != trigger_data.data() + trigger_data.size()
+		&& !std::equal(evaluation_data.begin(), evaluation_data.end(), trigger_evaluation_data.data() + (search_result - trigger_data.data()))) {
+		search_result = std::search(search_result + 1, trigger_data.data() + trigger_data.size(), searcher);
+	}
 	if(search_result != trigger_data.data() + trigger_data.size()) {
 		auto const start = search_result - trigger_data.data();
 		auto it = std::find(trigger_data_indices.begin(), trigger_data_indices.end(), int32_t(start));
@@ -1890,6 +1863,8 @@ dcon::trigger_key state::commit_trigger_data(std::vector<uint16_t> data) {
 		auto size = data.size();
 		trigger_data.resize(start + size, uint16_t(0));
 		std::copy_n(data.data(), size, trigger_data.data() + start);
+		trigger_evaluation_data.resize(start + size, uint16_t(0));
+		std::copy_n(evaluation_data.data(), size, trigger_evaluation_data.data() + start);
 		trigger_data_indices.push_back(int32_t(start));
 		assert(trigger_data_indices.size() <= std::numeric_limits<uint16_t>::max());
 		return dcon::trigger_key(dcon::trigger_key::value_base_t(trigger_data_indices.size() - 1 - 1));
@@ -3640,6 +3615,9 @@ void state::load_scenario_data(parsers::error_handler& err, sys::year_month_day
 
 void state::preload() {
 	adjacency_data_out_of_date = true;
+	province_definitions.pending_owner_changes.clear();
+	province_definitions.pending_unowned_change = false;
+	nations_with_cached_values_out_of_date.clear();
 	for(auto si : world.in_state_instance) {
 		si.set_naval_base_is_taken(false);
 		si.set_capital(dcon::province_id{});
@@ -3840,6 +3818,7 @@ void state::fill_unsaved_data() { // reconstructs derived values that are not di
 		}
 	}
 	ui_date = current_date;
+	trigger::invalidate_cached_results();
 
 	province::update_cached_values(*this);
 	nations::update_cached_values(*this);
@@ -3908,6 +3887,7 @@ void state::single_game_tick() {
 	// do update logic
 
 	current_date += 1;
+	trigger::invalidate_cached_results();
 
 	if(!is_playable_date(current_date, start_date, end_date)) {
 		mode = sys::game_mode_type::end_screen;
@@ -4326,10 +4306,7 @@ void state::single_game_tick() {
 	if(ymd_date.day == 1) {
 		if(ymd_date.month == 1) {
 			// yearly update : redo the upper house
-			for(auto n : world.in_nation) {
-				if(n.get_owned_province_count() != 0)
-					politics::recalculate_upper_house(*this, n);
-			}
+			politics::recalculate_upper_houses(*this);
 
 			ai::update_influence_priorities(*this);
 		}
@@ -4416,6 +4393,7 @@ void state::single_game_tick() {
 	}
 
 	ui_date = current_date;
+	trigger::invalidate_cached_results();
 
 	game_state_updated.store(true, std::memory_order::release);
 
@@ -4439,17 +4417,7 @@ void state::single_game_tick() {
 }
 
 sys::checksum_key state::get_save_checksum() {
-	dcon::load_record loaded = world.make_serialize_record_store_save();
-	auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[world.serialize_size(loaded)]);
-	std::byte* start = reinterpret_cast<std::byte*>(buffer.get());
-	world.serialize(start, loaded);
-
-	auto buffer_position = reinterpret_cast<uint8_t*>(start);
-	int32_t total_size_used = static_cast<int32_t>(buffer_position - buffer.get());
-
-	checksum_key key;
-	blake2b(&key, sizeof(key), buffer.get(), total_size_used, nullptr, 0);
-	return key;
+	return sys::update_save_checksum(*this, *save_checksums);
 }
 
 void state::debug_save_oos_dump() {
@@ -4463,6 +4431,8 @@ void state::debug_save_oos_dump() {
 		size_t total_size_used = reinterpret_cast<uint8_t*>(buffer_position) - save_buffer.get();
 		simple_fs::write_file(sdir, NATIVE("save.bin"), reinterpret_cast<const char*>(save_buffer.get()), uint32_t(total_size_used));
 	}
+	// per column / segment hashes, diff against the other side's file to find the diverging object.property
+	sys::write_save_checksum_report(*save_checksums, sdir, NATIVE("save_checksums.txt"));
 	{
 		auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[sys::sizeof_save_section(*this)]);
 		auto buffer_position = sys::write_save_section(buffer.get(), *this);
@@ -37,6 +37,8 @@
 
 namespace sys {
 
+struct save_checksum_tree;
+
 enum class gui_modes : uint8_t { faithful = 0, nouveau = 1, dummycabooseval = 2 };
 enum class projection_mode : uint8_t { globe_ortho = 0, flat = 1, globe_perpect = 2, num_of_modes = 3};
 
@@ -483,7 +485,8 @@ struct alignas(64) state {
 	absolute_time_point start_date;
 	absolute_time_point end_date;
 
-	std::vector<uint16_t> trigger_data;
+	std::vector<uint16_t> trigger_data; // as authored, for display
+	std::vector<uint16_t> trigger_evaluation_data; // same layout, and/or members ordered by cost (see triggers.hpp)
 	std::vector<int32_t> trigger_data_indices;
 	std::vector<uint16_t> effect_data;
 	std::vector<int32_t> effect_data_indices;
@@ -497,6 +500,7 @@ struct alignas(64) state {
 
 	bool adjacency_data_out_of_date = true;
 	bool national_cached_values_out_of_date = false;
+	std::vector<dcon::nation_id> nations_with_cached_values_out_of_date; // which nations need province::update_cached_values, if known
 	bool diplomatic_cached_values_out_of_date = false;
 	std::vector<dcon::nation_id> nations_by_rank;
 	std::vector<dcon::nation_id> nations_by_industrial_score;
@@ -509,6 +513,7 @@ struct alignas(64) state {
 	int32_t autosave_counter = 0; // which autosave file is next
 	sys::checksum_key scenario_checksum;// for checksum for savefiles
 	sys::checksum_key session_host_checksum;// for checking that the client can join a session
+	std::unique_ptr<sys::save_checksum_tree> save_checksums; // segment hashes from the last get_save_checksum (not saved)
 	native_string loaded_scenario_file;
 	native_string loaded_save_file;
 
@@ -703,12 +708,8 @@ struct alignas(64) state {
 	dcon::trigger_key commit_trigger_data(std::vector<uint16_t> data);
 	dcon::effect_key commit_effect_data(std::vector<uint16_t> data);
 
-	state() : untrans_key_to_text_sequence(0, text::vector_backed_ci_hash(key_data), text::vector_backed_ci_eq(key_data)), locale_key_to_text_sequence(0, text::vector_backed_ci_hash(key_data), text::vector_backed_ci_eq(key_data)), incoming_commands(1024), new_n_event(1024), new_f_n_event(1024), new_p_event(1024), new_f_p_event(1024), new_requests(256), new_messages(2048), naval_battle_reports(256), land_battle_reports(256) {
-
-		key_data.push_back(0);
-	}
-
-	~state() = default;
+	state();
+	~state(); // out of line, where save_checksum_tree is complete
 
 	void save_user_settings() const;
 	void load_user_settings();
@@ -314,6 +314,8 @@ void initialize_opengl(sys::state& state) {
 	// Allocate textures for the flags
 	state.open_gl.asset_textures.resize(
 			state.ui_defs.textures.size() + (state.world.national_identity_size() + 1) * state.flag_types.size());
+	state.open_gl.flag_sprites.resize(
+			state.ui_defs.textures.size() + (state.world.national_identity_size() + 1) * state.flag_types.size());
 
 	state.map_state.load_map(state);
 
@@ -554,6 +556,24 @@ void render_textured_rect(sys::state const& state, color_modification enabled, f
 	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 }
 
+void render_textured_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
+		flag_sprite const& flag, ui::rotation r, bool flipped, bool rtl) {
+	glBindVertexArray(state.open_gl.global_square_vao);
+
+	bind_vertices_by_rotation(state, r, flipped, rtl);
+
+	glUniform4f(parameters::drawing_rectangle, x, y, width, height);
+	glUniform4f(parameters::subrect, flag.subrect[0], flag.subrect[1], flag.subrect[2], flag.subrect[3]);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, flag.texture_handle);
+
+	GLuint subroutines[2] = {map_color_modification_to_index(enabled), parameters::atlas_sprite};
+	glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, subroutines); // must set all subroutines in one call
+
+	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+}
+
 void render_textured_rect_direct(sys::state const& state, float x, float y, float width, float height, uint32_t handle) {
 	glBindVertexArray(state.open_gl.global_square_vao);
 
@@ -690,6 +710,26 @@ void render_masked_rect(sys::state const& state, color_modification enabled, flo
 	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 }
 
+void render_masked_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
+		flag_sprite const& flag, GLuint mask_texture_handle, ui::rotation r, bool flipped, bool rtl) {
+	glBindVertexArray(state.open_gl.global_square_vao);
+
+	bind_vertices_by_rotation(state, r, flipped, rtl);
+
+	glUniform4f(parameters::drawing_rectangle, x, y, width, height);
+	glUniform4f(parameters::subrect, flag.subrect[0], flag.subrect[1], flag.subrect[2], flag.subrect[3]);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, flag.texture_handle);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, mask_texture_handle);
+
+	GLuint subroutines[2] = {map_color_modification_to_index(enabled), parameters::atlas_use_mask};
+	glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, subroutines); // must set all subroutines in one call
+
+	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+}
+
 void render_progress_bar(sys::state const& state, color_modification enabled, float progress, float x, float y, float width,
 		float height, GLuint left_texture_handle, GLuint right_texture_handle, ui::rotation r, bool flipped, bool rtl) {
 	glBindVertexArray(state.open_gl.global_square_vao);
@@ -769,7 +809,7 @@ void render_subsprite(sys::state const& state, color_modification enabled, int f
 }
 
 
-GLuint get_flag_texture_handle_from_tag(sys::state& state, const char tag[3]) {
+flag_sprite get_flag_sprite_from_tag(sys::state& state, const char tag[3]) {
 	char ltag[3];
 	ltag[0] = char(toupper(tag[0]));
 	ltag[1] = char(toupper(tag[1]));
@@ -783,7 +823,7 @@ GLuint get_flag_texture_handle_from_tag(sys::state& state, const char tag[3]) {
 	});
 	if(!bool(ident)) {
 		// QOL: We will print the text instead of displaying the flag, for ease of viewing invalid tags
-		return 0;
+		return flag_sprite{};
 	}
 	auto fat_id = dcon::fatten(state.world, ident);
 	auto nation = fat_id.get_nation_from_identity_holder();
@@ -793,7 +833,7 @@ GLuint get_flag_texture_handle_from_tag(sys::state& state, const char tag[3]) {
 	} else {
 		flag_type = culture::get_current_flag_type(state, ident);
 	}
-	return ogl::get_flag_handle(state, ident, flag_type);
+	return ogl::get_flag_sprite(state, ident, flag_type);
 }
 
 bool display_tag_is_valid(sys::state& state, char tag[3]) {
@@ -858,15 +898,15 @@ void render_text_flag(sys::state& state, text::embedded_flag ico, float x, float
 	} else {
 		flag_type = culture::get_current_flag_type(state, ico.tag);
 	}
-	GLuint flag_texture_handle = ogl::get_flag_handle(state, ico.tag, flag_type);
+	auto flag = ogl::get_flag_sprite(state, ico.tag, flag_type);
 
-	GLuint icon_subroutines[2] = { map_color_modification_to_index(cmod), parameters::no_filter };
+	GLuint icon_subroutines[2] = { map_color_modification_to_index(cmod), parameters::atlas_sprite };
 	glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, icon_subroutines);//push
 	bind_vertices_by_rotation(state, ui::rotation::upright, false, false);
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, flag_texture_handle);
+	glBindTexture(GL_TEXTURE_2D, flag.texture_handle);
 	glUniform4f(parameters::drawing_rectangle, x, icon_baseline + font_size * 0.15f, 1.5f * font_size * 0.9f,  font_size * 0.9f);
-	glUniform4f(ogl::parameters::subrect, 0.f, 1.f, 0.f, 1.f);
+	glUniform4f(ogl::parameters::subrect, flag.subrect[0], flag.subrect[1], flag.subrect[2], flag.subrect[3]);
 	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 }
 
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <string_view>
+#include <memory>
 
 #ifndef GLEW_STATIC
 #define GLEW_STATIC
@@ -42,6 +43,8 @@ inline constexpr GLuint subsprite_b = 15;
 inline constexpr GLuint alternate_tint = 16;
 inline constexpr GLuint linegraph_color = 17;
 inline constexpr GLuint atlas_index = 18;
+inline constexpr GLuint atlas_sprite = 18;
+inline constexpr GLuint atlas_use_mask = 19;
 } // namespace parameters
 
 enum class color_modification { none, disabled, interactable, interactable_disabled };
@@ -188,6 +191,9 @@ inline void debug_callback(GLenum source, GLenum type, GLuint id, GLenum severit
 
 struct data {
 	tagged_vector<texture, dcon::texture_id> asset_textures;
+	std::unique_ptr<texture_streamer> flag_streamer; // started on the first flag request
+	flag_atlas flags;
+	tagged_vector<flag_sprite, dcon::texture_id> flag_sprites; // indexed like asset_textures; only flag entries are used
 
 	void* context = nullptr;
 	GLuint ui_shader_program = 0;
@@ -276,6 +282,8 @@ public:
 void render_simple_rect(sys::state const& state, float x, float y, float width, float height, ui::rotation r, bool flipped);
 void render_textured_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
 		GLuint texture_handle, ui::rotation r, bool flipped, bool rtl);
+void render_textured_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
+		flag_sprite const& flag, ui::rotation r, bool flipped, bool rtl);
 void render_textured_rect_direct(sys::state const& state, float x, float y, float width, float height, uint32_t handle);
 void render_linegraph(sys::state const& state, color_modification enabled, float x, float y, float width, float height, lines& l);
 void render_linegraph(sys::state const& state, color_modification enabled, float x, float y, float width, float height, float r, float g, float b, lines& l);
@@ -286,6 +294,8 @@ void render_bordered_rect(sys::state const& state, color_modification enabled, f
 		float height, GLuint texture_handle, ui::rotation r, bool flipped, bool rtl);
 void render_masked_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
 		GLuint texture_handle, GLuint mask_texture_handle, ui::rotation r, bool flipped, bool rtl);
+void render_masked_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
+		flag_sprite const& flag, GLuint mask_texture_handle, ui::rotation r, bool flipped, bool rtl);
 void render_progress_bar(sys::state const& state, color_modification enabled, float progress, float x, float y, float width,
 		float height, GLuint left_texture_handle, GLuint right_texture_handle, ui::rotation r, bool flipped, bool rtl);
 void render_tinted_textured_rect(sys::state const& state, float x, float y, float width, float height, float r, float g, float b,
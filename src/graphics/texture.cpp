@@ -441,11 +441,183 @@ GLuint load_file_and_return_handle(native_string const& native_name, simple_fs::
 	return 0;
 }
 
-GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type) {
+flag_sprite flag_atlas::allocate_cell() {
+	auto const page = used_cells / flag_cells_per_page;
+	auto const in_page = used_cells % flag_cells_per_page;
+	if(page >= int32_t(pages.size())) {
+		GLuint handle = 0;
+		glGenTextures(1, &handle);
+		glBindTexture(GL_TEXTURE_2D, handle);
+		glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, flag_atlas_page_size, flag_atlas_page_size);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		// cells whose flag has not been streamed in yet are drawn transparent
+		glClearTexImage(handle, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		pages.push_back(handle);
+	}
+	++used_cells;
+
+	flag_sprite result;
+	result.texture_handle = pages[page];
+	result.subrect[0] = float((in_page % flag_cells_per_row) * flag_cell_stride_x + 1) / float(flag_atlas_page_size);
+	result.subrect[1] = float(flag_cell_width) / float(flag_atlas_page_size);
+	result.subrect[2] = float((in_page / flag_cells_per_row) * flag_cell_stride_y + 1) / float(flag_atlas_page_size);
+	result.subrect[3] = float(flag_cell_height) / float(flag_atlas_page_size);
+	return result;
+}
+
+void flag_atlas::upload_cell(flag_sprite const& cell, uint8_t const* pixels) {
+	auto const x = int32_t(cell.subrect[0] * float(flag_atlas_page_size) + 0.5f) - 1;
+	auto const y = int32_t(cell.subrect[2] * float(flag_atlas_page_size) + 0.5f) - 1;
+	glBindTexture(GL_TEXTURE_2D, cell.texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, flag_cell_stride_x, flag_cell_stride_y, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void fill_flag_cell(uint8_t const* source, int32_t size_x, int32_t size_y, std::vector<uint8_t>& cell_pixels) {
+	cell_pixels.resize(size_t(flag_cell_stride_x * flag_cell_stride_y * 4));
+	for(int32_t y = 0; y < flag_cell_stride_y; ++y) {
+		// the border rows and columns repeat the edge of the flag
+		auto const cy = std::clamp(y - 1, 0, flag_cell_height - 1);
+		auto const sy = std::max((float(cy) + 0.5f) * float(size_y) / float(flag_cell_height) - 0.5f, 0.0f);
+		auto const y0 = std::min(int32_t(sy), size_y - 1);
+		auto const y1 = std::min(y0 + 1, size_y - 1);
+		auto const fy = sy - float(y0);
+		for(int32_t x = 0; x < flag_cell_stride_x; ++x) {
+			auto const cx = std::clamp(x - 1, 0, flag_cell_width - 1);
+			auto const sx = std::max((float(cx) + 0.5f) * float(size_x) / float(flag_cell_width) - 0.5f, 0.0f);
+			auto const x0 = std::min(int32_t(sx), size_x - 1);
+			auto const x1 = std::min(x0 + 1, size_x - 1);
+			auto const fx = sx - float(x0);
+			for(int32_t c = 0; c < 4; ++c) {
+				auto const top = float(source[(y0 * size_x + x0) * 4 + c]) * (1.0f - fx) + float(source[(y0 * size_x + x1) * 4 + c]) * fx;
+				auto const bottom = float(source[(y1 * size_x + x0) * 4 + c]) * (1.0f - fx) + float(source[(y1 * size_x + x1) * 4 + c]) * fx;
+				cell_pixels[(y * flag_cell_stride_x + x) * 4 + c] = uint8_t(top * (1.0f - fy) + bottom * fy + 0.5f);
+			}
+		}
+	}
+}
+
+// runs on the streaming thread, so it must not touch any gl state
+bool decode_flag_file(simple_fs::directory const& root, native_string const& native_name, streamed_texture& out) {
+	if(native_name.length() > 4) { // try loading as a dds
+		auto dds_name = native_name;
+		if(auto pos = dds_name.find_last_of('.'); pos != native_string::npos) {
+			dds_name[pos + 1] = NATIVE('d');
+			dds_name[pos + 2] = NATIVE('d');
+			dds_name[pos + 3] = NATIVE('s');
+			dds_name.resize(pos + 4);
+		}
+		auto file = open_file(root, dds_name);
+		if(file) {
+			auto content = simple_fs::view_contents(*file);
+			auto first = reinterpret_cast<uint8_t const*>(content.data);
+			out.dds_contents.assign(first, first + content.file_size);
+			return true;
+		}
+	}
+
+	auto file = open_file(root, native_name);
+	if(file) {
+		auto content = simple_fs::view_contents(*file);
+		int32_t file_channels = 4;
+		int32_t size_x = 0;
+		int32_t size_y = 0;
+		auto pixels = stbi_load_from_memory(reinterpret_cast<uint8_t const*>(content.data), int32_t(content.file_size),
+			&size_x, &size_y, &file_channels, 4);
+		if(!pixels)
+			return false;
+		fill_flag_cell(pixels, size_x, size_y, out.cell_pixels);
+		STBI_FREE(pixels);
+		return true;
+	}
+	return false;
+}
+
+texture_streamer::texture_streamer(simple_fs::file_system const& fs) : fs(fs), worker([this]() { run(); }) { }
+
+texture_streamer::~texture_streamer() {
+	{
+		std::lock_guard lock(queue_lock);
+		quitting = true;
+	}
+	queue_signal.notify_one();
+	if(worker.joinable())
+		worker.join();
+}
+
+void texture_streamer::run() {
+	auto root = get_root(fs);
+	while(true) {
+		texture_request r;
+		{
+			std::unique_lock lock(queue_lock);
+			queue_signal.wait(lock, [&]() { return quitting || !requests.empty(); });
+			if(quitting)
+				return;
+			r = std::move(requests.front());
+			requests.pop_front();
+		}
+
+		streamed_texture result;
+		result.id = r.id;
+		if(!decode_flag_file(root, r.file_name, result))
+			decode_flag_file(root, r.fallback_file_name, result);
+
+		std::lock_guard lock(queue_lock);
+		finished.push_back(std::move(result));
+	}
+}
+
+void texture_streamer::request(texture_request&& r) {
+	{
+		std::lock_guard lock(queue_lock);
+		requests.push_back(std::move(r));
+	}
+	queue_signal.notify_one();
+}
+
+void texture_streamer::take_finished(std::vector<streamed_texture>& out, uint32_t max_count) {
+	std::lock_guard lock(queue_lock);
+	while(!finished.empty() && max_count > 0) {
+		out.push_back(std::move(finished.front()));
+		finished.pop_front();
+		--max_count;
+	}
+}
+
+void upload_streamed_textures(sys::state& state) {
+	if(!state.open_gl.flag_streamer)
+		return;
+
+	std::vector<streamed_texture> ready;
+	state.open_gl.flag_streamer->take_finished(ready, max_streamed_uploads_per_frame);
+	for(auto& t : ready) {
+		if(!t.dds_contents.empty()) {
+			// the dds loader creates its own texture; read the pixels back out of it to fill the atlas cell
+			uint32_t w = 0;
+			uint32_t h = 0;
+			GLuint dds_handle = SOIL_direct_load_DDS_from_memory(t.dds_contents.data(), uint32_t(t.dds_contents.size()), w, h, 0);
+			if(dds_handle) {
+				std::vector<uint8_t> pixels(size_t(4 * w * h));
+				glGetTextureImage(dds_handle, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<int32_t>(4 * w * h), pixels.data());
+				glDeleteTextures(1, &dds_handle);
+				fill_flag_cell(pixels.data(), int32_t(w), int32_t(h), t.cell_pixels);
+			}
+		}
+		if(!t.cell_pixels.empty())
+			state.open_gl.flags.upload_cell(state.open_gl.flag_sprites[t.id], t.cell_pixels.data());
+	}
+}
+
+flag_sprite get_flag_sprite(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type) {
 	auto const offset = culture::get_remapped_flag_type(state, type);
 	dcon::texture_id id = dcon::texture_id{ dcon::texture_id::value_base_t(state.ui_defs.textures.size() + (1 + nat_id.index()) * state.flag_types.size() + offset) };
 	if(state.open_gl.asset_textures[id].loaded) {
-		return state.open_gl.asset_textures[id].texture_handle;
+		return state.open_gl.flag_sprites[id];
 	} else { // load from file
 		native_string file_str;
 		file_str += NATIVE("gfx");
@@ -575,11 +747,19 @@ GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, cul
 			break;
 		}
 		file_str += NATIVE(".tga");
-		GLuint p_tex = load_file_and_return_handle(file_str, state.common_fs, state.open_gl.asset_textures[id], false);
-		if(!p_tex) {
-			return load_file_and_return_handle(default_file_str, state.common_fs, state.open_gl.asset_textures[id], false);
-		}
-		return p_tex;
+		// the flag is decoded in the background; until it is uploaded its atlas cell stays transparent
+		auto sprite = state.open_gl.flags.allocate_cell();
+		state.open_gl.flag_sprites[id] = sprite;
+		auto& asset_texture = state.open_gl.asset_textures[id];
+		asset_texture.texture_handle = sprite.texture_handle;
+		asset_texture.size_x = flag_cell_width;
+		asset_texture.size_y = flag_cell_height;
+		asset_texture.channels = 4;
+		asset_texture.loaded = true;
+		if(!state.open_gl.flag_streamer)
+			state.open_gl.flag_streamer = std::make_unique<texture_streamer>(state.common_fs);
+		state.open_gl.flag_streamer->request(texture_request{ id, std::move(file_str), std::move(default_file_str) });
+		return sprite;
 	}
 }
 
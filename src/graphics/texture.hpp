@@ -1,5 +1,9 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include "container_types.hpp"
 
 #ifndef GLEW_STATIC
@@ -12,7 +16,18 @@ namespace ogl {
 class texture;
 
 GLuint get_texture_handle(sys::state& state, dcon::texture_id id, bool keep_data);
-GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type);
+// where a flag lives inside one of the flag atlas pages; subrect is in the (x offset, x scale, y offset, y scale) form
+// that the atlas subroutines of the ui shader expect
+struct flag_sprite {
+	GLuint texture_handle = 0;
+	float subrect[4] = { 0.f, 1.f, 0.f, 1.f };
+
+	explicit operator bool() const {
+		return texture_handle != 0;
+	}
+};
+
+flag_sprite get_flag_sprite(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type);
 GLuint load_file_and_return_handle(native_string const& native_name, simple_fs::file_system const& fs, texture& asset_texture, bool keep_data);
 
 enum {
@@ -21,6 +36,68 @@ enum {
 
 GLuint SOIL_direct_load_DDS_from_memory(unsigned char const* const buffer, uint32_t buffer_length, uint32_t& width, uint32_t& height, int soil_flags);
 
+// uploads at most this many streamed textures per rendered frame, so that opening a window full of flags does not stall a frame
+constexpr uint32_t max_streamed_uploads_per_frame = 16;
+
+struct texture_request {
+	dcon::texture_id id;
+	native_string file_name;
+	native_string fallback_file_name;
+};
+
+struct streamed_texture {
+	dcon::texture_id id;
+	std::vector<uint8_t> cell_pixels; // rgba pixels already scaled and padded to a flag atlas cell
+	std::vector<uint8_t> dds_contents; // dds files are handed over undecoded, since the dds loader creates the gl texture itself
+};
+
+// flags are scaled into fixed size cells, so that a flag's place in the atlas is known before its file has been decoded
+inline constexpr int32_t flag_atlas_page_size = 2048;
+inline constexpr int32_t flag_cell_width = 96;
+inline constexpr int32_t flag_cell_height = 64;
+// every cell is surrounded by a one texel border repeating its edge, so linear filtering never picks up a neighbouring flag
+inline constexpr int32_t flag_cell_stride_x = flag_cell_width + 2;
+inline constexpr int32_t flag_cell_stride_y = flag_cell_height + 2;
+inline constexpr int32_t flag_cells_per_row = flag_atlas_page_size / flag_cell_stride_x;
+inline constexpr int32_t flag_cells_per_page = flag_cells_per_row * (flag_atlas_page_size / flag_cell_stride_y);
+
+struct flag_atlas {
+	std::vector<GLuint> pages;
+	int32_t used_cells = 0;
+
+	// reserves the next free cell, creating a new page when the last one is full
+	flag_sprite allocate_cell();
+	// the cell is given by its sprite; pixels must hold flag_cell_stride_x * flag_cell_stride_y rgba texels
+	void upload_cell(flag_sprite const& cell, uint8_t const* pixels);
+};
+
+// scales a decoded rgba image into a padded atlas cell
+void fill_flag_cell(uint8_t const* source, int32_t size_x, int32_t size_y, std::vector<uint8_t>& cell_pixels);
+
+// reads and decodes image files on a background thread; the results are picked up and uploaded by the render thread
+class texture_streamer {
+	simple_fs::file_system const& fs;
+	std::mutex queue_lock;
+	std::condition_variable queue_signal;
+	std::deque<texture_request> requests;
+	std::deque<streamed_texture> finished;
+	bool quitting = false;
+	std::thread worker;
+
+	void run();
+public:
+	texture_streamer(simple_fs::file_system const& fs);
+	texture_streamer(texture_streamer const&) = delete;
+	~texture_streamer();
+
+	void request(texture_request&& r);
+	// moves up to max_count decoded textures into out
+	void take_finished(std::vector<streamed_texture>& out, uint32_t max_count);
+};
+
+// called once per frame from the render thread
+void upload_streamed_textures(sys::state& state);
+
 class texture {
 	GLuint texture_handle = 0;
 
@@ -45,7 +122,7 @@ public:
 	friend GLuint get_texture_handle(sys::state& state, dcon::texture_id id, bool keep_data);
 	friend GLuint load_file_and_return_handle(native_string const& native_name, simple_fs::file_system const& fs,
 			texture& asset_texture, bool keep_data);
-	friend GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type);
+	friend flag_sprite get_flag_sprite(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type);
 };
 
 class data_texture {
@@ -73,7 +73,8 @@ struct command_info {
 		list_all_flags,
 		set_auto_choice_all,
 		clear_auto_choice_all,
-		economy_dump
+		economy_dump,
+		trigger_cache_stats
 	} mode = type::none;
 	std::string_view desc;
 	struct argument_info {
@@ -267,6 +268,9 @@ inline constexpr command_info possible_commands[] = {
 		command_info{ "ecodump", command_info::type::economy_dump, "Starts writing economy info to the disk. Could deteriorate performance.",
 				{command_info::argument_info{}, command_info::argument_info{},
 						command_info::argument_info{}, command_info::argument_info{}} },
+		command_info{ "tcache", command_info::type::trigger_cache_stats, "Shows the hits / misses of the cached trigger results used by the ui",
+				{command_info::argument_info{}, command_info::argument_info{},
+						command_info::argument_info{}, command_info::argument_info{}} },
 };
 
 uint32_t levenshtein_distance(std::string_view s1, std::string_view s2) {
@@ -2086,6 +2090,12 @@ void ui::console_edit::edit_box_enter(sys::state& state, std::string_view s) noe
 		log_to_console(state, parent, state.cheat_data.province_names ? "✔" : "✘");
 		break;
 	}
+	case command_info::type::trigger_cache_stats:
+	{
+		auto stats = trigger::get_cache_statistics();
+		log_to_console(state, parent, "Hits: " + std::to_string(stats.hits) + " / Misses: " + std::to_string(stats.misses));
+		break;
+	}
 	case command_info::type::economy_dump:
 	{
 		if(state.cheat_data.ecodump) {
@@ -105,6 +105,10 @@ public:
 		}
 	}
 
+	bool displays_game_state() noexcept override {
+		return false;
+	}
+
 	void clear_list(sys::state& state) noexcept {
 		console_output_list->raw_text.clear();
 		console_output_list->impl_on_update(state);
@@ -55,6 +55,12 @@ public:
 		on_drag_finish(state);
 	}
 
+	// elements (windows, mostly) that show nothing derived from the game state can return false here; they and their children are
+	// then skipped when the ui is refreshed because the simulation advanced, but are still updated normally by ui events
+	virtual bool displays_game_state() noexcept {
+		return true;
+	}
+
 	virtual tooltip_behavior has_tooltip(sys::state& state) noexcept { // used to test whether a tooltip is possible
 		return tooltip_behavior::no_tooltip;
 	}
@@ -59,7 +59,7 @@ message_result container_base::impl_on_key_down(sys::state& state, sys::virtual_
 void container_base::impl_on_update(sys::state& state) noexcept {
 	on_update(state);
 	for(auto& c : children) {
-		if(c->is_visible()) {
+		if(c->is_visible() && (!state.ui_state.refreshing_for_game_state || c->displays_game_state())) {
 			c->impl_on_update(state);
 		}
 	}
@@ -1889,18 +1889,18 @@ void flag_button2::button_action(sys::state& state) noexcept {
 void flag_button2::on_update(sys::state& state) noexcept {
 	auto nid = retrieve<dcon::nation_id>(state, this);
 	if(nid) {
-		flag_texture_handle = ogl::get_flag_handle(state, state.world.nation_get_identity_from_identity_holder(nid), culture::get_current_flag_type(state, nid));
+		flag_texture = ogl::get_flag_sprite(state, state.world.nation_get_identity_from_identity_holder(nid), culture::get_current_flag_type(state, nid));
 		return;
 	}
 
 	auto tid = retrieve<dcon::national_identity_id>(state, this);
 	if(!nid && tid) {
-		flag_texture_handle = ogl::get_flag_handle(state, tid, culture::get_current_flag_type(state, tid));
+		flag_texture = ogl::get_flag_sprite(state, tid, culture::get_current_flag_type(state, tid));
 		return;
 	}
 
 	auto reb_tag = state.national_definitions.rebel_id;
-	flag_texture_handle = ogl::get_flag_handle(state, reb_tag, culture::flag_type::default_flag);
+	flag_texture = ogl::get_flag_sprite(state, reb_tag, culture::flag_type::default_flag);
 }
 
 void flag_button2::update_tooltip(sys::state& state, int32_t x, int32_t y, text::columnar_layout& contents) noexcept {
@@ -1934,7 +1934,7 @@ void flag_button2::render(sys::state& state, int32_t x, int32_t y) noexcept {
 	} else if(base_data.get_element_type() == element_type::button) {
 		gid = base_data.data.button.button_image;
 	}
-	if(gid && flag_texture_handle > 0) {
+	if(gid && flag_texture) {
 		auto const& gfx_def = state.ui_defs.gfx[gid];
 		if(gfx_def.type_dependent) {
 			auto mask_handle = ogl::get_texture_handle(state, dcon::texture_id(gfx_def.type_dependent - 1), true);
@@ -1944,11 +1944,11 @@ void flag_button2::render(sys::state& state, int32_t x, int32_t y) noexcept {
 				float(y) + float(base_data.size.y - mask_tex.size_y) * 0.5f,
 				float(mask_tex.size_x),
 				float(mask_tex.size_y),
-				flag_texture_handle, mask_handle, base_data.get_rotation(), gfx_def.is_vertically_flipped(),
+				flag_texture, mask_handle, base_data.get_rotation(), gfx_def.is_vertically_flipped(),
 				false);
 		} else {
 			ogl::render_textured_rect(state, get_color_modification(this == state.ui_state.under_mouse, disabled, interactable),
-				float(x), float(y), float(base_data.size.x), float(base_data.size.y), flag_texture_handle, base_data.get_rotation(),
+				float(x), float(y), float(base_data.size.x), float(base_data.size.y), flag_texture, base_data.get_rotation(),
 				gfx_def.is_vertically_flipped(),
 				false);
 		}
@@ -1968,7 +1968,7 @@ void flag_button::set_current_nation(sys::state& state, dcon::national_identity_
 	} else {
 		flag_type = culture::get_current_flag_type(state, ident);
 	}
-	flag_texture_handle = ogl::get_flag_handle(state, ident, flag_type);
+	flag_texture = ogl::get_flag_sprite(state, ident, flag_type);
 }
 
 void flag_button::on_update(sys::state& state) noexcept {
@@ -1986,7 +1986,7 @@ void flag_button::render(sys::state& state, int32_t x, int32_t y) noexcept {
 	} else if(base_data.get_element_type() == element_type::button) {
 		gid = base_data.data.button.button_image;
 	}
-	if(gid && flag_texture_handle > 0) {
+	if(gid && flag_texture) {
 		auto const& gfx_def = state.ui_defs.gfx[gid];
 		if(gfx_def.type_dependent) {
 			auto mask_handle = ogl::get_texture_handle(state, dcon::texture_id(gfx_def.type_dependent - 1), true);
@@ -1996,11 +1996,11 @@ void flag_button::render(sys::state& state, int32_t x, int32_t y) noexcept {
 				float(y) + float(base_data.size.y - mask_tex.size_y) * 0.5f,
 				float(mask_tex.size_x),
 				float(mask_tex.size_y),
-				flag_texture_handle, mask_handle, base_data.get_rotation(), gfx_def.is_vertically_flipped(),
+				flag_texture, mask_handle, base_data.get_rotation(), gfx_def.is_vertically_flipped(),
 				false);
 		} else {
 			ogl::render_textured_rect(state, get_color_modification(this == state.ui_state.under_mouse, disabled, interactable),
-				float(x), float(y), float(base_data.size.x), float(base_data.size.y), flag_texture_handle, base_data.get_rotation(),
+				float(x), float(y), float(base_data.size.x), float(base_data.size.y), flag_texture, base_data.get_rotation(),
 				gfx_def.is_vertically_flipped(),
 				false);
 		}
@@ -541,7 +541,7 @@ public:
 
 class flag_button : public button_element_base {
 protected:
-	GLuint flag_texture_handle = 0;
+	ogl::flag_sprite flag_texture;
 
 public:
 	virtual dcon::national_identity_id get_current_nation(sys::state& state) noexcept;
@@ -559,7 +559,7 @@ public:
 
 class flag_button2 : public button_element_base {
 public:
-	GLuint flag_texture_handle = 0;
+	ogl::flag_sprite flag_texture;
 
 	void button_action(sys::state& state) noexcept override;
 	void on_update(sys::state& state) noexcept override;
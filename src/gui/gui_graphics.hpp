@@ -409,6 +409,7 @@ struct state {
 	bool scrollbar_continuous_movement = false;
 	float last_fps = 0.f;
 	bool lazy_load_in_game = false;
+	bool refreshing_for_game_state = false; // set while the ui is being updated only because the simulation advanced
 	element_base* scroll_target = nullptr;
 	element_base* drag_target = nullptr;
 	element_base* edit_target = nullptr;
@@ -287,6 +287,9 @@ struct notify_setting_update { };
 
 class options_menu_window : public window_element_base {
 	bool setting_changed = false;
+	bool displays_game_state() noexcept override {
+		return false;
+	}
 	std::unique_ptr<element_base> make_child(sys::state& state, std::string_view name, dcon::gui_def_id id) noexcept override {
 		if(name == "close_button") {
 			return make_element_by_type<generic_close_button>(state, id);
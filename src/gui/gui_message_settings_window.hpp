@@ -325,6 +325,10 @@ public:
 		set_visible(state, false);
 	}
 
+	bool displays_game_state() noexcept override {
+		return false;
+	}
+
 	void on_hide(sys::state& state) noexcept override {
 		if(settings_changed) {
 			settings_changed = false;
@@ -252,7 +252,7 @@ public:
 
 class save_flag : public button_element_base {
 protected:
-	GLuint flag_texture_handle = 0;
+	ogl::flag_sprite flag_texture;
 	bool visible = false;
 public:
 	void button_action(sys::state& state) noexcept override { }
@@ -277,7 +277,7 @@ public:
 			else
 				ft = culture::flag_type(state.world.government_type_get_flag(gov));
 		}
-		flag_texture_handle = ogl::get_flag_handle(state, tag, ft);
+		flag_texture = ogl::get_flag_sprite(state, tag, ft);
 	}
 
 	void render(sys::state& state, int32_t x, int32_t y) noexcept override {
@@ -290,7 +290,7 @@ public:
 		} else if(base_data.get_element_type() == element_type::button) {
 			gid = base_data.data.button.button_image;
 		}
-		if(gid && flag_texture_handle > 0) {
+		if(gid && flag_texture) {
 			auto& gfx_def = state.ui_defs.gfx[gid];
 			if(gfx_def.type_dependent) {
 				auto mask_handle = ogl::get_texture_handle(state, dcon::texture_id(gfx_def.type_dependent - 1), true);
@@ -300,11 +300,11 @@ public:
 					float(y) + float(base_data.size.y - mask_tex.size_y) * 0.5f,
 					float(mask_tex.size_x),
 					float(mask_tex.size_y),
-					flag_texture_handle, mask_handle, base_data.get_rotation(), gfx_def.is_vertically_flipped(),
+					flag_texture, mask_handle, base_data.get_rotation(), gfx_def.is_vertically_flipped(),
 					false);
 			} else {
 				ogl::render_textured_rect(state, get_color_modification(this == state.ui_state.under_mouse, disabled, interactable),
-					float(x), float(y), float(base_data.size.x), float(base_data.size.y), flag_texture_handle, base_data.get_rotation(),
+					float(x), float(y), float(base_data.size.x), float(base_data.size.y), flag_texture, base_data.get_rotation(),
 					gfx_def.is_vertically_flipped(),
 					false);
 			}
@@ -1377,9 +1377,9 @@ public:
 			state.world.for_each_decision([&](dcon::decision_id di) {
 				if(nation_id != state.local_player_nation || !state.world.decision_get_hide_notification(di)) {
 					auto lim = state.world.decision_get_potential(di);
-					if(!lim || trigger::evaluate(state, lim, trigger::to_generic(nation_id), trigger::to_generic(nation_id), 0)) {
+					if(!lim || trigger::evaluate_cached(state, lim, trigger::to_generic(nation_id), trigger::to_generic(nation_id), 0)) {
 						auto allow = state.world.decision_get_allow(di);
-						if(!allow || trigger::evaluate(state, allow, trigger::to_generic(nation_id), trigger::to_generic(nation_id), 0)) {
+						if(!allow || trigger::evaluate_cached(state, allow, trigger::to_generic(nation_id), trigger::to_generic(nation_id), 0)) {
 							auto fat_id = dcon::fatten(state.world, di);
 							auto box = text::open_layout_box(contents);
 							text::add_to_layout_box(state, contents, box, fat_id.get_name(), m);
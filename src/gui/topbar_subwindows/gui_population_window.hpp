@@ -2358,6 +2358,28 @@ private:
 	pop_list_sort sort = pop_list_sort::size;
 	bool sort_ascend = true;
 
+	// what the current contents of the pop list were built from; the list is reused as long as none of it changes
+	struct pop_list_inputs {
+		sys::date date;
+		pop_list_filter filter;
+		dcon::nation_id player;
+		pop_list_sort sort = pop_list_sort::size;
+		bool sort_ascend = true;
+		std::vector<bool> pop_filters;
+		uint32_t pop_count = 0;
+		int32_t owned_provinces = 0;
+
+		bool operator==(pop_list_inputs const& o) const = default;
+	};
+	pop_list_inputs pop_list_built_from;
+	bool pop_list_built = false;
+
+	pop_list_inputs current_pop_list_inputs(sys::state& state) {
+		auto nation_id = std::holds_alternative<dcon::nation_id>(filter) ? std::get<dcon::nation_id>(filter) : state.local_player_nation;
+		return pop_list_inputs{ state.ui_date, filter, state.local_player_nation, sort, sort_ascend, pop_filters, state.world.pop_size(),
+			int32_t(state.world.nation_get_owned_province_count(nation_id)) };
+	}
+
 	void update_pop_list(sys::state& state) {
 		country_pop_listbox->row_contents.clear();
 
@@ -2388,145 +2410,106 @@ private:
 		}
 	}
 
+	template<typename T>
+	static std::vector<uint32_t> name_ranks(sys::state& state, uint32_t count) {
+		std::vector<std::string> names(count);
+		std::vector<uint32_t> order(count);
+		for(uint32_t i = 0; i < count; ++i) {
+			names[i] = text::get_name_as_string(state, T{ typename T::value_base_t(i) });
+			order[i] = i;
+		}
+		std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return names[a] < names[b]; });
+		std::vector<uint32_t> ranks(count);
+		for(uint32_t i = 0; i < count; ++i)
+			ranks[order[i]] = (i != 0 && names[order[i]] == names[order[i - 1]]) ? ranks[order[i - 1]] : i;
+		return ranks;
+	}
+
 	void sort_pop_list(sys::state& state) {
-		std::function<bool(dcon::pop_id, dcon::pop_id)> fn;
+		auto& rows = country_pop_listbox->row_contents;
+
+		// every pop gets its sort key computed once up front (rather than once per comparison, which for the name based
+		// sorts meant building two strings per comparison); pops are then sorted ascending by that key
+		std::vector<uint32_t> ranks;
 		switch(sort) {
-		case pop_list_sort::type:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_poptype().id.index() < b_fat_id.get_poptype().id.index();
-			};
-			break;
-		case pop_list_sort::size:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_size() > b_fat_id.get_size();
-			};
-			break;
-		case pop_list_sort::con:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_consciousness() > b_fat_id.get_consciousness();
-			};
-			break;
-		case pop_list_sort::mil:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_militancy() > b_fat_id.get_militancy();
-			};
-			break;
 		case pop_list_sort::religion:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return text::get_name_as_string(state, a_fat_id.get_religion()) < text::get_name_as_string(state, b_fat_id.get_religion());
-			};
+			ranks = name_ranks<dcon::religion_id>(state, state.world.religion_size());
 			break;
 		case pop_list_sort::nationality:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return text::get_name_as_string(state, a_fat_id.get_culture()) < text::get_name_as_string(state, b_fat_id.get_culture());
-			};
+			ranks = name_ranks<dcon::culture_id>(state, state.world.culture_size());
 			break;
 		case pop_list_sort::location:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return text::get_name_as_string(state, a_fat_id.get_province_from_pop_location()) < text::get_name_as_string(state, b_fat_id.get_province_from_pop_location());
-			};
-			break;
-		case pop_list_sort::cash:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_savings() > b_fat_id.get_savings();
-			};
-			break;
-		case pop_list_sort::unemployment:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_employment() / a_fat_id.get_size() < b_fat_id.get_employment() / b_fat_id.get_size();
-			};
-			break;
-		case pop_list_sort::ideology:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_dominant_ideology().id.index() < b_fat_id.get_dominant_ideology().id.index();
-			};
+			ranks = name_ranks<dcon::province_id>(state, state.world.province_size());
 			break;
-		case pop_list_sort::issues:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_dominant_issue_option().id.index() < b_fat_id.get_dominant_issue_option().id.index();
-			};
-			break;
-		case pop_list_sort::life_needs:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_life_needs_satisfaction() > b_fat_id.get_life_needs_satisfaction();
-			};
-			break;
-		case pop_list_sort::everyday_needs:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_everyday_needs_satisfaction() > b_fat_id.get_everyday_needs_satisfaction();
-			};
-			break;
-		case pop_list_sort::luxury_needs:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_luxury_needs_satisfaction() > b_fat_id.get_luxury_needs_satisfaction();
-			};
-			break;
-		case pop_list_sort::literacy:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_literacy() > b_fat_id.get_literacy();
-			};
-			break;
-		case pop_list_sort::revoltrisk:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				auto a_reb = a_fat_id.get_rebel_faction_from_pop_rebellion_membership();
-				auto b_reb = b_fat_id.get_rebel_faction_from_pop_rebellion_membership();
-				auto a_mov = a_fat_id.get_movement_from_pop_movement_membership();
-				auto b_mov = b_fat_id.get_movement_from_pop_movement_membership();
-				if(a_reb || b_reb) {
-					return a_reb ? (b_reb ? a_reb.id.index() > b_reb.id.index() : true) : false;
-				} else if(a_mov || b_mov) {
-					return a_mov ? (b_mov ? a_mov.id.index() > b_mov.id.index() : true) : false;
-				} else {
-					return a_fat_id.id.index() > b_fat_id.id.index();
-				}
-			};
-			break;
-		case pop_list_sort::change:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return demographics::get_monthly_pop_increase(state, a_fat_id.id) > demographics::get_monthly_pop_increase(state, b_fat_id.id);
-			};
+		default:
 			break;
 		}
-		std::stable_sort(country_pop_listbox->row_contents.begin(), country_pop_listbox->row_contents.end(),
-				[&](dcon::pop_id a, dcon::pop_id b) {
-					return fn(a, b);
-				});
+
+		auto sort_key = [&](dcon::pop_id p) -> double {
+			auto fat_id = dcon::fatten(state.world, p);
+			switch(sort) {
+			case pop_list_sort::type:
+				return double(fat_id.get_poptype().id.index());
+			case pop_list_sort::size:
+				return -double(fat_id.get_size());
+			case pop_list_sort::con:
+				return -double(fat_id.get_consciousness());
+			case pop_list_sort::mil:
+				return -double(fat_id.get_militancy());
+			case pop_list_sort::religion:
+				return double(ranks[fat_id.get_religion().id.index()]);
+			case pop_list_sort::nationality:
+				return double(ranks[fat_id.get_culture().id.index()]);
+			case pop_list_sort::location:
+				return double(ranks[fat_id.get_province_from_pop_location().id.index()]);
+			case pop_list_sort::cash:
+				return -double(fat_id.get_savings());
+			case pop_list_sort::unemployment:
+				return double(fat_id.get_employment() / fat_id.get_size());
+			case pop_list_sort::ideology:
+				return double(fat_id.get_dominant_ideology().id.index());
+			case pop_list_sort::issues:
+				return double(fat_id.get_dominant_issue_option().id.index());
+			case pop_list_sort::life_needs:
+				return -double(fat_id.get_life_needs_satisfaction());
+			case pop_list_sort::everyday_needs:
+				return -double(fat_id.get_everyday_needs_satisfaction());
+			case pop_list_sort::luxury_needs:
+				return -double(fat_id.get_luxury_needs_satisfaction());
+			case pop_list_sort::literacy:
+				return -double(fat_id.get_literacy());
+			case pop_list_sort::revoltrisk:
+			{
+				// rebels first, then movement members, each group by descending id
+				auto reb = fat_id.get_rebel_faction_from_pop_rebellion_membership();
+				auto mov = fat_id.get_movement_from_pop_movement_membership();
+				if(reb)
+					return -(3.0e9 + double(reb.id.index()));
+				if(mov)
+					return -(2.0e9 + double(mov.id.index()));
+				return -double(p.index());
+			}
+			case pop_list_sort::change:
+				return -double(demographics::get_monthly_pop_increase(state, p));
+			}
+			return 0.0;
+		};
+
+		std::vector<std::pair<double, dcon::pop_id>> keyed(rows.size());
+		if(rows.size() >= 4096) {
+			concurrency::parallel_for(uint32_t(0), uint32_t(rows.size()), [&](uint32_t i) {
+				keyed[i] = std::pair<double, dcon::pop_id>(sort_key(rows[i]), rows[i]);
+			});
+		} else {
+			for(uint32_t i = 0; i < uint32_t(rows.size()); ++i)
+				keyed[i] = std::pair<double, dcon::pop_id>(sort_key(rows[i]), rows[i]);
+		}
+		std::stable_sort(keyed.begin(), keyed.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+		for(uint32_t i = 0; i < uint32_t(rows.size()); ++i)
+			rows[i] = keyed[i].second;
+
 		if(!sort_ascend) {
-			std::reverse(country_pop_listbox->row_contents.begin(), country_pop_listbox->row_contents.end());
+			std::reverse(rows.begin(), rows.end());
 		}
 	}
 
@@ -2751,8 +2734,13 @@ public:
 
 	void on_update(sys::state& state) noexcept override {
 		if(country_pop_listbox) {
-			update_pop_list(state);
-			sort_pop_list(state);
+			auto inputs = current_pop_list_inputs(state);
+			if(!pop_list_built || pop_list_built_from != inputs) {
+				update_pop_list(state);
+				sort_pop_list(state);
+				pop_list_built_from = std::move(inputs);
+				pop_list_built = true;
+			}
 			country_pop_listbox->update(state);
 		}
 		if(left_side_listbox) {
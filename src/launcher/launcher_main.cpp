@@ -997,6 +997,8 @@ void make_mod_file() {
 		}
 
 		sys::checksum_key scenario_key;
+		// bookmark saves are compressed and written on this thread while the next bookmark is being built
+		std::thread bookmark_writer;
 
 		for(uint32_t date_index = 0; date_index < uint32_t(bookmark_context.bookmark_dates.size()); date_index++) {
 			err.accumulated_errors.clear();
@@ -1029,14 +1031,26 @@ void make_mod_file() {
 					return a.ident.count > b.ident.count;
 				});
 				scenario_key = game_state->scenario_checksum;
+
+#ifndef NDEBUG
+				auto trigger_report = std::string("Estimated cost per evaluation of the most expensive triggers:\r\n\r\n") + parsers::expensive_triggers_report(*game_state, 50);
+				auto pdir = simple_fs::get_or_create_settings_directory();
+				simple_fs::write_file(pdir, NATIVE("scenario_trigger_costs.txt"), trigger_report.data(), uint32_t(trigger_report.length()));
+#endif
 			} else {
 #ifndef NDEBUG
 				sys::write_scenario_file(*game_state, std::to_wstring(date_index) + NATIVE(".bin"), 0);
 #endif
 				game_state->scenario_checksum = scenario_key;
-				sys::write_save_file(*game_state, sys::save_type::bookmark, bookmark_context.bookmark_dates[date_index].name_);
+				if(bookmark_writer.joinable())
+					bookmark_writer.join();
+				bookmark_writer = std::thread([finished_state = std::move(game_state), name = bookmark_context.bookmark_dates[date_index].name_]() {
+					sys::write_save_file(*finished_state, sys::save_type::bookmark, name);
+				});
 			}
 		}
+		if(bookmark_writer.joinable())
+			bookmark_writer.join();
 
 		if(!err.accumulated_errors.empty() || !err.accumulated_warnings.empty()) {
 			auto assembled_file = std::string("You can still play the mod, but it might be unstable\r\nThe following problems were encountered while creating the scenario:\r\n\r\nErrors:\r\n") + err.accumulated_errors + "\r\n\r\nWarnings:\r\n" + err.accumulated_warnings;
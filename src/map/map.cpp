@@ -1187,7 +1187,33 @@ void display_data::set_selected_province(sys::state& state, dcon::province_id pr
 }
 
 void display_data::set_province_color(std::vector<uint32_t> const& prov_color) {
-	gen_prov_color_texture(texture_arrays[texture_array_province_color], prov_color, 2);
+	if(uploaded_province_color.size() != prov_color.size()) {
+		gen_prov_color_texture(texture_arrays[texture_array_province_color], prov_color, 2);
+		uploaded_province_color = prov_color;
+		return;
+	}
+
+	// map modes are recomputed every tick while open, but usually only a few provinces change color: upload just the span
+	// of 256 wide rows between the first and the last changed province of each layer
+	auto const layer_size = prov_color.size() / 2;
+	glBindTexture(GL_TEXTURE_2D_ARRAY, texture_arrays[texture_array_province_color]);
+	for(uint32_t layer = 0; layer < 2; ++layer) {
+		auto const begin = layer * layer_size;
+		auto const end = begin + layer_size;
+		auto first = std::mismatch(prov_color.begin() + begin, prov_color.begin() + end, uploaded_province_color.begin() + begin);
+		if(first.first == prov_color.begin() + end)
+			continue;
+		auto last = std::mismatch(prov_color.rbegin() + (prov_color.size() - end), prov_color.rbegin() + (prov_color.size() - begin),
+				uploaded_province_color.rbegin() + (prov_color.size() - end));
+		auto const first_row = uint32_t(std::distance(prov_color.begin() + begin, first.first)) / 256;
+		auto const last_row = uint32_t(std::distance(last.first, prov_color.rend() - begin) - 1) / 256;
+
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, first_row, layer, 256, last_row - first_row + 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+				&prov_color[begin + first_row * 256]);
+		std::copy(prov_color.begin() + begin + first_row * 256, prov_color.begin() + begin + (last_row + 1) * 256,
+				uploaded_province_color.begin() + begin + first_row * 256);
+	}
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 }
 
 void add_drag_box_line(std::vector<screen_vertex>& drag_box_vertices, glm::vec2 pos1, glm::vec2 pos2, glm::vec2 size, bool vertical) {
@@ -1571,6 +1597,20 @@ bool get_provinces_part_of_rr_path(sys::state& state, std::vector<bool>& visited
 }
 
 void display_data::update_railroad_paths(sys::state& state) {
+	// The layout depends on which provinces have a railroad, and for those on their state and on the number of
+	// connections the admin efficiency of that state allows; when none of these changed the current geometry is kept
+	std::vector<uint32_t> layout_key(2 * (state.world.province_size() + 1), 0);
+	for(const auto p : state.world.in_province) {
+		if(p.get_building_level(economy::province_building_type::railroad) == 0)
+			continue;
+		auto const si = p.get_state_membership();
+		layout_key[2 * p.id.index()] = 1 + uint32_t(province::state_admin_efficiency(state, si) * 2.75f);
+		layout_key[2 * p.id.index() + 1] = uint32_t(si.id.index() + 1);
+	}
+	if(layout_key == railroad_layout_key)
+		return;
+	railroad_layout_key = std::move(layout_key);
+
 	// Create paths for the main railroad sections
 	std::vector<bool> visited_prov(state.world.province_size() + 1, false);
 	std::vector<bool> rr_ends(state.world.province_size() + 1, false);
@@ -2356,6 +2396,7 @@ void display_data::load_map(sys::state& state) {
 	glGenTextures(1, &texture_arrays[texture_array_province_color]);
 	glBindTexture(GL_TEXTURE_2D_ARRAY, texture_arrays[texture_array_province_color]);
 	glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, 256, 256, 2);
+	uploaded_province_color.clear();
 	ogl::set_gltex_parameters(texture_arrays[texture_array_province_color], GL_TEXTURE_2D_ARRAY, GL_NEAREST, GL_CLAMP_TO_EDGE);
 
 	// Get the province_highlight handle
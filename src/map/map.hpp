@@ -111,6 +111,7 @@ public:
 	std::vector<textured_line_vertex> railroad_vertices;
 	std::vector<GLint> railroad_starts;
 	std::vector<GLsizei> railroad_counts;
+	std::vector<uint32_t> railroad_layout_key; // the inputs of the railroad layout when railroad_vertices were last built
 	std::vector<textured_line_vertex_b> coastal_vertices;
 	std::vector<GLint> coastal_starts;
 	std::vector<GLsizei> coastal_counts;
@@ -149,6 +150,8 @@ public:
 	std::vector<uint8_t> median_terrain_type;
 	std::vector<uint32_t> province_area;
 	std::vector<uint8_t> diagonal_borders;
+	// what is currently in the province color texture, so that map mode updates only upload the rows that changed
+	std::vector<uint32_t> uploaded_province_color;
 
 	// map pixel -> province id
 	std::vector<uint16_t> province_id_map;
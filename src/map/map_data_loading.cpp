@@ -245,7 +245,8 @@ void display_data::load_terrain_data(parsers::scenario_building_context& context
 		auto terrain_resolution = internal_make_index_map();
 
 		if(terrain_data.size_x == int32_t(size_x) && terrain_data.size_y == int32_t(size_y)) {
-			for(uint32_t ty = 0; ty < size_y; ++ty) {
+			// rows are independent, so they are classified in parallel
+			concurrency::parallel_for(uint32_t(0), size_y, [&](uint32_t ty) {
 				uint32_t y = size_y - ty - 1;
 				for(uint32_t x = 0; x < size_x; ++x) {
 
@@ -316,12 +317,12 @@ void display_data::load_terrain_data(parsers::scenario_building_context& context
 
 					}
 				}
-			}
+			});
 		}
 	}
 
 	// Gets rid of any stray land terrain that has been painted outside the borders
-	for(uint32_t y = 0; y < size_y; ++y) {
+	concurrency::parallel_for(uint32_t(0), size_y, [&](uint32_t y) {
 		for(uint32_t x = 0; x < size_x; ++x) {
 			if(province_id_map[y * size_x + x] == 0) { // If there is no province define at that location
 				terrain_id_map[y * size_x + x] = uint8_t(255);
@@ -333,7 +334,7 @@ void display_data::load_terrain_data(parsers::scenario_building_context& context
 				}
 			}
 		}
-	}
+	});
 
 	// Load the terrain
 	load_median_terrain_type(context);
@@ -394,6 +395,28 @@ void display_data::load_provinces_mid_point(parsers::scenario_building_context&
 	}
 }
 
+// Resolves one row of the province image. Neighbouring pixels nearly always belong to the same province, so the
+// last lookup is reused until the color changes.
+void resolve_province_row(ankerl::unordered_dense::map<uint32_t, dcon::province_id> const& color_to_province, uint8_t const* pixels, uint16_t* out, uint32_t count) {
+	uint32_t last_color = 0;
+	uint16_t last_id = 0;
+	bool has_last = false;
+	for(uint32_t x = 0; x < count; ++x) {
+		auto color = sys::pack_color(pixels[x * 4 + 0], pixels[x * 4 + 1], pixels[x * 4 + 2]);
+		if(!has_last || color != last_color) {
+			last_color = color;
+			has_last = true;
+			if(auto it = color_to_province.find(color); it != color_to_province.end()) {
+				assert(it->second);
+				last_id = province::to_map_id(it->second);
+			} else {
+				last_id = 0;
+			}
+		}
+		out[x] = last_id;
+	}
+}
+
 void display_data::load_province_data(parsers::scenario_building_context& context, ogl::image& image) {
 	uint32_t imsz = uint32_t(size_x * size_y);
 	if(!context.new_maps) {
@@ -406,33 +429,19 @@ void display_data::load_province_data(parsers::scenario_building_context& contex
 			province_id_map[i] = 0;
 		}
 		auto first_actual_map_pixel = top_free_space * size_x; // schombert: where the real data starts
-		for(; i < first_actual_map_pixel + image.size_x * image.size_y; ++i) {
-			uint8_t* ptr = image.data + (i - first_actual_map_pixel) * 4; // schombert: subtract to find our offset in the actual image data
-			auto color = sys::pack_color(ptr[0], ptr[1], ptr[2]);
-			if(auto it = context.map_color_to_province_id.find(color); it != context.map_color_to_province_id.end()) {
-				assert(it->second);
-				province_id_map[i] = province::to_map_id(it->second);
-			} else {
-				province_id_map[i] = 0;
-			}
-		}
+		concurrency::parallel_for(uint32_t(0), uint32_t(image.size_y), [&](uint32_t row) {
+			auto offset = row * uint32_t(image.size_x);
+			resolve_province_row(context.map_color_to_province_id, image.data + offset * 4, province_id_map.data() + first_actual_map_pixel + offset, uint32_t(image.size_x));
+		});
+		i = first_actual_map_pixel + uint32_t(image.size_x * image.size_y);
 		for(; i < imsz; ++i) { // schombert: fill remainder with nothing
 			province_id_map[i] = 0;
 		}
 	} else {
 		province_id_map.resize(imsz);
-		for(uint32_t i = 0; i < imsz; ++i) {
-			auto map_x = i % size_x;
-			auto map_y = i / size_x;
-			uint8_t* ptr = image.data + (map_x + size_x * (size_y - map_y - 1)) * 4;
-			auto color = sys::pack_color(ptr[0], ptr[1], ptr[2]);
-			if(auto it = context.map_color_to_province_id.find(color); it != context.map_color_to_province_id.end()) {
-				assert(it->second);
-				province_id_map[i] = province::to_map_id(it->second);
-			} else {
-				province_id_map[i] = 0;
-			}
-		}
+		concurrency::parallel_for(uint32_t(0), size_y, [&](uint32_t map_y) {
+			resolve_province_row(context.map_color_to_province_id, image.data + size_x * (size_y - map_y - 1) * 4, province_id_map.data() + map_y * size_x, size_x);
+		});
 	}
 
 	load_provinces_mid_point(context);
@@ -480,7 +489,7 @@ void display_data::load_map_data(parsers::scenario_building_context& context) {
 		auto terrain_resolution = internal_make_index_map();
 
 		if(river_image_data.size_x == int32_t(size_x) && river_image_data.size_y == int32_t(size_y)) {
-			for(uint32_t ty = 0; ty < size_y; ++ty) {
+			concurrency::parallel_for(uint32_t(0), size_y, [&](uint32_t ty) {
 				uint32_t y = size_y - ty - 1;
 
 				for(uint32_t x = 0; x < size_x; ++x) {
@@ -496,7 +505,7 @@ void display_data::load_map_data(parsers::scenario_building_context& context) {
 						river_data[ty * size_x + x] = 255;
 
 				}
-			}
+			});
 		}
 	}
 
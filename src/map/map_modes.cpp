@@ -48,7 +48,8 @@ std::vector<uint32_t> ideology_map_from(sys::state& state) {
 				empty_color = 0x222222;
 			}
 			auto const pkey = pop_demographics::to_key(state, fat_id.id);
-			state.world.for_each_province([&](dcon::province_id prov_id) {
+			concurrency::parallel_for(uint32_t(0), state.world.province_size(), [&](uint32_t index) {
+				dcon::province_id prov_id{ dcon::province_id::value_base_t(index) };
 				auto i = province::to_map_id(prov_id);
 				float total = 0.f;
 				float value = 0.f;
@@ -63,7 +64,8 @@ std::vector<uint32_t> ideology_map_from(sys::state& state) {
 			});
 		}
 	} else {
-		state.world.for_each_province([&](dcon::province_id prov_id) {
+		concurrency::parallel_for(uint32_t(0), state.world.province_size(), [&](uint32_t index) {
+			dcon::province_id prov_id{ dcon::province_id::value_base_t(index) };
 			auto id = province::to_map_id(prov_id);
 			float total_pops = state.world.province_get_demographics(prov_id, demographics::total);
 			dcon::ideology_id primary_id;
@@ -115,7 +117,8 @@ std::vector<uint32_t> issue_map_from(sys::state& state) {
 				empty_color = 0x222222;
 			}
 			auto const pkey = pop_demographics::to_key(state, fat_id.id);
-			state.world.for_each_province([&](dcon::province_id prov_id) {
+			concurrency::parallel_for(uint32_t(0), state.world.province_size(), [&](uint32_t index) {
+				dcon::province_id prov_id{ dcon::province_id::value_base_t(index) };
 				auto i = province::to_map_id(prov_id);
 				float total = 0.f;
 				float value = 0.f;
@@ -130,7 +133,8 @@ std::vector<uint32_t> issue_map_from(sys::state& state) {
 			});
 		}
 	} else {
-		state.world.for_each_province([&](dcon::province_id prov_id) {
+		concurrency::parallel_for(uint32_t(0), state.world.province_size(), [&](uint32_t index) {
+			dcon::province_id prov_id{ dcon::province_id::value_base_t(index) };
 			auto id = province::to_map_id(prov_id);
 			float total_pops = state.world.province_get_demographics(prov_id, demographics::total);
 			dcon::issue_option_id primary_id;
@@ -2,12 +2,12 @@
 
 std::vector<uint32_t> get_global_population_color(sys::state& state) {
 	std::vector<float> prov_population(state.world.province_size() + 1);
-	std::unordered_map<int32_t, float> continent_max_pop = {};
+	std::vector<float> continent_max_pop(state.world.modifier_size() + 1, 0.f);
 
 	state.world.for_each_province([&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
 		float population = state.world.province_get_demographics(prov_id, demographics::total);
-		auto cid = fat_id.get_continent().id.index();
+		auto cid = fat_id.get_continent().id.index() + 1;
 		continent_max_pop[cid] = std::max(continent_max_pop[cid], population);
 		auto i = province::to_map_id(prov_id);
 		prov_population[i] = population;
@@ -20,7 +20,7 @@ std::vector<uint32_t> get_global_population_color(sys::state& state) {
 
 	state.world.for_each_province([&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
-		auto cid = fat_id.get_continent().id.index();
+		auto cid = fat_id.get_continent().id.index() + 1;
 		auto i = province::to_map_id(prov_id);
 		float gradient_index = prov_population[i] / continent_max_pop[cid];
 
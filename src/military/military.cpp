@@ -90,6 +90,73 @@ void restore_unsaved_values(sys::state& state) {
 	update_all_recruitable_regiments(state);
 	regenerate_total_regiment_counts(state);
 	update_naval_supply_points(state);
+	rebuild_army_location_index(state);
+}
+
+void add_army_presence(sys::state& state, dcon::province_id p, dcon::nation_id controller) {
+	if(!p || uint32_t(p.index()) >= state.military_definitions.army_presence_by_province.size())
+		return; // index not built yet; it will pick this army up when it is
+	auto& presence = state.military_definitions.army_presence_by_province[p];
+	for(auto& e : presence) {
+		if(e.controller == controller) {
+			++e.count;
+			return;
+		}
+	}
+	presence.push_back(army_presence{ controller, uint16_t(1) });
+}
+
+void remove_army_presence(sys::state& state, dcon::province_id p, dcon::nation_id controller) {
+	if(!p || uint32_t(p.index()) >= state.military_definitions.army_presence_by_province.size())
+		return;
+	auto& presence = state.military_definitions.army_presence_by_province[p];
+	for(uint32_t i = 0; i < presence.size(); ++i) {
+		if(presence[i].controller == controller) {
+			assert(presence[i].count > 0);
+			--presence[i].count;
+			if(presence[i].count == 0) {
+				presence[i] = presence.back();
+				presence.pop_back();
+			}
+			return;
+		}
+	}
+	assert(false); // army was not in the index
+}
+
+void rebuild_army_location_index(sys::state& state) {
+	auto& index = state.military_definitions.army_presence_by_province;
+	index = tagged_vector<std::vector<army_presence>, dcon::province_id>(state.world.province_size());
+	for(auto a : state.world.in_army) {
+		add_army_presence(state, a.get_location_from_army_location(), a.get_controller_from_army_control());
+	}
+}
+
+void set_army_location(sys::state& state, dcon::army_id a, dcon::province_id p) {
+	auto controller = state.world.army_get_controller_from_army_control(a);
+	remove_army_presence(state, state.world.army_get_location_from_army_location(a), controller);
+	state.world.army_set_location_from_army_location(a, p);
+	add_army_presence(state, p, controller);
+}
+
+int32_t army_count_in_province(sys::state const& state, dcon::province_id p, dcon::nation_id controller) {
+	for(auto& e : state.military_definitions.army_presence_by_province[p]) {
+		if(e.controller == controller)
+			return int32_t(e.count);
+	}
+	return 0;
+}
+
+bool has_hostile_army_in_province(sys::state const& state, dcon::province_id p, dcon::nation_id n) {
+	for(auto& e : state.military_definitions.army_presence_by_province[p]) {
+		if(!n) { // rebel controlled: any nation's army is hostile
+			if(e.controller)
+				return true;
+		} else if(!e.controller || (e.controller != n && are_at_war(state, e.controller, n))) {
+			return true;
+		}
+	}
+	return false;
 }
 
 bool can_use_cb_against(sys::state& state, dcon::nation_id from, dcon::nation_id target) {
@@ -1000,11 +1067,20 @@ void update_recruitable_regiments(sys::state& state, dcon::nation_id n) {
 	}
 }
 void update_all_recruitable_regiments(sys::state& state) {
+	// counting the soldier pops of each province is the expensive part and only reads that province, so it is spread over
+	// the worker threads; the per nation sums are then made serially
+	std::vector<uint16_t> province_regiments(state.world.province_size(), uint16_t(0));
+	concurrency::parallel_for(uint32_t(0), state.world.province_size(), [&](uint32_t i) {
+		dcon::province_id p{ dcon::province_id::value_base_t(i) };
+		if(state.world.province_get_nation_from_province_ownership(p))
+			province_regiments[i] = uint16_t(regiments_max_possible_from_province(state, p));
+	});
+
 	state.world.execute_serial_over_nation([&](auto ids) { state.world.nation_set_recruitable_regiments(ids, ve::int_vector(0)); });
 	state.world.for_each_province([&](dcon::province_id p) {
 		auto owner = state.world.province_get_nation_from_province_ownership(p);
 		if(owner) {
-			state.world.nation_get_recruitable_regiments(owner) += uint16_t(regiments_max_possible_from_province(state, p));
+			state.world.nation_get_recruitable_regiments(owner) += province_regiments[p.index()];
 		}
 	});
 }
@@ -3972,7 +4048,7 @@ void army_arrives_in_province(sys::state& state, dcon::army_id a, dcon::province
 	assert(state.world.army_is_valid(a));
 	assert(!state.world.army_get_battle_from_army_battle_participation(a));
 
-	state.world.army_set_location_from_army_location(a, p);
+	set_army_location(state, a, p);
 	auto regs = state.world.army_get_army_membership(a);
 	if(!state.world.army_get_black_flag(a) && !state.world.army_get_is_retreating(a) && regs.begin() != regs.end()) {
 		auto owner_nation = state.world.army_get_controller_from_army_control(a);
@@ -4364,6 +4440,7 @@ void cleanup_army(sys::state& state, dcon::army_id n) {
 		}
 	}
 
+	remove_army_presence(state, state.world.army_get_location_from_army_location(n), state.world.army_get_controller_from_army_control(n));
 	state.world.delete_army(n);
 }
 
@@ -4407,6 +4484,9 @@ void end_battle(sys::state& state, dcon::land_battle_id b, battle_result result)
 	assert(location);
 
 	auto make_leaderless = [&](dcon::army_id a) {
+		auto a_location = state.world.army_get_location_from_army_location(a);
+		remove_army_presence(state, a_location, state.world.army_get_controller_from_army_control(a));
+		add_army_presence(state, a_location, dcon::nation_id{});
 		state.world.army_set_controller_from_army_control(a, dcon::nation_id{});
 		state.world.army_set_controller_from_army_rebel_control(a, dcon::rebel_faction_id{});
 		state.world.army_set_is_retreating(a, true);
@@ -4841,9 +4921,9 @@ bool will_recieve_attrition(sys::state& state, dcon::army_id a) {
 	auto attrition_mod = 1.0f + army_controller.get_modifier_values(sys::national_mod_offsets::land_attrition);
 
 	float greatest_hostile_fort = 0.0f;
-	for(auto adj : state.world.province_get_province_adjacency(prov)) {
-		if((adj.get_type() & (province::border::impassible_bit | province::border::coastal_bit)) == 0) {
-			auto other = adj.get_connected_provinces(0) != prov ? adj.get_connected_provinces(0) : adj.get_connected_provinces(1);
+	for(auto& nb : province::adjacent_provinces(state, prov)) {
+		if((nb.type & (province::border::impassible_bit | province::border::coastal_bit)) == 0) {
+			auto other = fatten(state.world, nb.province);
 			if(other.get_building_level(economy::province_building_type::fort) > 0) {
 				if(are_at_war(state, army_controller, other.get_nation_from_province_control())) {
 					greatest_hostile_fort = std::max(greatest_hostile_fort, float(other.get_building_level(economy::province_building_type::fort)));
@@ -4879,9 +4959,9 @@ float relative_attrition_amount(sys::state& state, dcon::army_id a, dcon::provin
 
 	float greatest_hostile_fort = 0.0f;
 
-	for(auto adj : state.world.province_get_province_adjacency(prov)) {
-		if((adj.get_type() & (province::border::impassible_bit | province::border::coastal_bit)) == 0) {
-			auto other = adj.get_connected_provinces(0) != prov ? adj.get_connected_provinces(0) : adj.get_connected_provinces(1);
+	for(auto& nb : province::adjacent_provinces(state, prov)) {
+		if((nb.type & (province::border::impassible_bit | province::border::coastal_bit)) == 0) {
+			auto other = fatten(state.world, nb.province);
 			if(other.get_building_level(economy::province_building_type::fort) > 0) {
 				if(are_at_war(state, army_controller, other.get_nation_from_province_control())) {
 					greatest_hostile_fort = std::max(greatest_hostile_fort, float(other.get_building_level(economy::province_building_type::fort)));
@@ -4927,9 +5007,9 @@ void apply_attrition(sys::state& state) {
 
 				float greatest_hostile_fort = 0.0f;
 
-				for(auto adj : state.world.province_get_province_adjacency(prov)) {
-					if((adj.get_type() & (province::border::impassible_bit | province::border::coastal_bit)) == 0) {
-						auto other = adj.get_connected_provinces(0) != prov ? adj.get_connected_provinces(0) : adj.get_connected_provinces(1);
+				for(auto& nb : province::adjacent_provinces(state, prov)) {
+					if((nb.type & (province::border::impassible_bit | province::border::coastal_bit)) == 0) {
+						auto other = fatten(state.world, nb.province);
 						if(other.get_building_level(economy::province_building_type::fort) > 0) {
 							if(are_at_war(state, army_controller, other.get_nation_from_province_control())) {
 								greatest_hostile_fort = std::max(greatest_hostile_fort, float(other.get_building_level(economy::province_building_type::fort)));
@@ -5024,6 +5104,221 @@ void apply_regiment_damage(sys::state& state) {
 	}
 }
 
+/*
+The regiments engaged on a battle's frontage are gathered into a small struct-of-arrays block, one per row, so that the
+damage for every slot can be computed by flat loops over contiguous floats instead of chasing regiment -> nation -> unit
+stats for each individual hit. Empty slots keep neutral divisors so that those loops can run without branches; their
+results are simply never applied.
+*/
+struct land_combat_row {
+	std::array<float, 30> power;      // attack / gun power x 0.1 + 1
+	std::array<float, 30> support;
+	std::array<float, 30> discipline;
+	std::array<float, 30> tactics;    // base military tactics + tactics of the tech nation
+	std::array<float, 30> org_resist; // 1 + land organisation of the tech nation
+	std::array<float, 30> strength;
+	std::array<float, 30> org;
+	std::array<float, 30> pending_damage;
+	std::array<float, 30> maneuver;
+	std::array<unit_type, 30> type;
+};
+
+struct land_combat_damage {
+	std::array<float, 30> back_str;  // damage from the back row slot to the opposing front row slot
+	std::array<float, 30> back_org;
+	std::array<float, 30> front_str; // damage from the front row slot to its target
+	std::array<float, 30> front_org;
+	std::array<int32_t, 30> front_target; // opposing front row slot, or -1
+};
+
+struct land_combat_losses {
+	float infantry = 0.0f;
+	float cavalry = 0.0f;
+	float support = 0.0f;
+	float casualties = 0.0f;
+};
+
+void gather_land_combat_row(sys::state& state, std::array<dcon::regiment_id, 30> const& regs, int32_t combat_width, land_combat_row& row) {
+	for(int32_t i = 0; i < 30; ++i) {
+		row.power[i] = 0.0f;
+		row.support[i] = 0.0f;
+		row.discipline[i] = 1.0f;
+		row.tactics[i] = 1.0f;
+		row.org_resist[i] = 1.0f;
+		row.strength[i] = 0.0f;
+		row.org[i] = 0.0f;
+		row.pending_damage[i] = 0.0f;
+		row.maneuver[i] = 0.0f;
+		row.type[i] = unit_type::infantry;
+	}
+	for(int32_t i = 0; i < combat_width; ++i) {
+		if(!regs[i])
+			continue;
+
+		assert(state.world.regiment_is_valid(regs[i]));
+
+		auto tech_nation = tech_nation_for_regiment(state, regs[i]);
+		auto utype = state.world.regiment_get_type(regs[i]);
+		auto& stats = state.world.nation_get_unit_stats(tech_nation, utype);
+
+		row.power[i] = stats.attack_or_gun_power * 0.1f + 1.0f;
+		row.support[i] = stats.support;
+		row.discipline[i] = stats.discipline_or_evasion;
+		row.tactics[i] = state.defines.base_military_tactics + state.world.nation_get_modifier_values(tech_nation, sys::national_mod_offsets::military_tactics);
+		row.org_resist[i] = 1.0f + state.world.nation_get_modifier_values(tech_nation, sys::national_mod_offsets::land_organisation);
+		row.strength[i] = state.world.regiment_get_strength(regs[i]);
+		row.org[i] = state.world.regiment_get_org(regs[i]);
+		row.pending_damage[i] = state.world.regiment_get_pending_damage(regs[i]);
+		row.maneuver[i] = state.military_definitions.unit_base_definitions[utype].maneuver;
+		row.type[i] = state.military_definitions.unit_base_definitions[utype].type;
+	}
+}
+
+void scatter_land_combat_row(sys::state& state, std::array<dcon::regiment_id, 30> const& regs, int32_t combat_width, land_combat_row const& row) {
+	for(int32_t i = 0; i < combat_width; ++i) {
+		if(regs[i]) {
+			state.world.regiment_set_strength(regs[i], row.strength[i]);
+			state.world.regiment_set_org(regs[i], row.org[i]);
+			state.world.regiment_set_pending_damage(regs[i], row.pending_damage[i]);
+		}
+	}
+}
+
+// front row units hit the unit opposite them or, failing that, may look up to `maneuver` positions to one side
+void find_land_combat_targets(std::array<dcon::regiment_id, 30> const& attackers, std::array<dcon::regiment_id, 30> const& targets, land_combat_row const& row, int32_t combat_width, land_combat_damage& out) {
+	for(int32_t i = 0; i < 30; ++i) {
+		out.front_target[i] = -1;
+	}
+	for(int32_t i = 0; i < combat_width; ++i) {
+		if(!attackers[i])
+			continue;
+		if(targets[i]) {
+			out.front_target[i] = i;
+		} else if(row.maneuver[i] > 0.0f) {
+			for(int32_t cnt = 1; i - cnt * 2 >= 0 && cnt <= int32_t(row.maneuver[i]); ++cnt) {
+				if(targets[i - cnt * 2]) {
+					out.front_target[i] = i - cnt * 2;
+					break;
+				}
+			}
+		}
+	}
+}
+
+void apply_land_combat_hit(land_combat_row& target_row, int32_t slot, float str_damage, float org_damage, land_combat_losses& losses) {
+	str_damage = std::min(str_damage, target_row.strength[slot]);
+	target_row.pending_damage[slot] += str_damage;
+	target_row.strength[slot] -= str_damage;
+	losses.casualties += str_damage;
+
+	target_row.org[slot] = std::max(0.0f, target_row.org[slot] - org_damage);
+	switch(target_row.type[slot]) {
+		case unit_type::infantry:
+			losses.infantry += str_damage;
+			break;
+		case unit_type::cavalry:
+			losses.cavalry += str_damage;
+			break;
+		case unit_type::support:
+			// fallthrough
+		case unit_type::special:
+			losses.support += str_damage;
+			break;
+		default:
+			break;
+	}
+}
+
+void apply_land_combat_damage(sys::state& state, dcon::land_battle_id b, land_combat_modifiers const& mods) {
+	auto combat_width = state.world.land_battle_get_combat_width(b);
+
+	auto& att_back = state.world.land_battle_get_attacker_back_line(b);
+	auto& def_back = state.world.land_battle_get_defender_back_line(b);
+	auto& att_front = state.world.land_battle_get_attacker_front_line(b);
+	auto& def_front = state.world.land_battle_get_defender_front_line(b);
+
+	auto const attacker_mod = mods.attacker_mod;
+	auto const defender_mod = mods.defender_mod;
+	auto const defender_fort = mods.defender_fort;
+	auto const attacker_org_bonus = mods.attacker_org_bonus;
+	auto const defender_org_bonus = mods.defender_org_bonus;
+
+	land_combat_row att_back_row;
+	land_combat_row def_back_row;
+	land_combat_row att_front_row;
+	land_combat_row def_front_row;
+	gather_land_combat_row(state, att_back, combat_width, att_back_row);
+	gather_land_combat_row(state, def_back, combat_width, def_back_row);
+	gather_land_combat_row(state, att_front, combat_width, att_front_row);
+	gather_land_combat_row(state, def_front, combat_width, def_front_row);
+
+	land_combat_damage att_damage;
+	land_combat_damage def_damage;
+	find_land_combat_targets(att_front, def_front, att_front_row, combat_width, att_damage);
+	find_land_combat_targets(def_front, att_front, def_front_row, combat_width, def_damage);
+
+	// raw damage of every possible hit; these loops are branch free over contiguous floats
+
+	for(int32_t i = 0; i < 30; ++i) {
+		att_damage.back_str[i] = str_dam_mul * att_back_row.power[i] * att_back_row.support[i] * attacker_mod /
+			(defender_fort * def_front_row.tactics[i]);
+		att_damage.back_org[i] = org_dam_mul * att_back_row.power[i] * att_back_row.support[i] * attacker_mod /
+			(defender_fort * defender_org_bonus * def_front_row.discipline[i] * def_front_row.org_resist[i]);
+
+		def_damage.back_str[i] = str_dam_mul * def_back_row.power[i] * def_back_row.support[i] * defender_mod /
+			(att_front_row.tactics[i]);
+		def_damage.back_org[i] = org_dam_mul * def_back_row.power[i] * def_back_row.support[i] * defender_mod /
+			(attacker_org_bonus * def_back_row.discipline[i] * att_front_row.org_resist[i]);
+	}
+	for(int32_t i = 0; i < 30; ++i) {
+		auto t = std::max(att_damage.front_target[i], 0);
+		att_damage.front_str[i] = str_dam_mul * att_front_row.power[i] * attacker_mod /
+			(defender_fort * def_front_row.tactics[t]);
+		att_damage.front_org[i] = org_dam_mul * att_front_row.power[i] * attacker_mod /
+			(defender_fort * def_front_row.discipline[t] * defender_org_bonus * def_front_row.org_resist[t]);
+	}
+	for(int32_t i = 0; i < 30; ++i) {
+		auto t = std::max(def_damage.front_target[i], 0);
+		def_damage.front_str[i] = str_dam_mul * def_front_row.power[i] * defender_mod /
+			(att_front_row.tactics[t]);
+		def_damage.front_org[i] = org_dam_mul * def_front_row.power[i] * defender_mod /
+			(attacker_org_bonus * def_front_row.discipline[i] * att_front_row.org_resist[t]);
+	}
+
+	// apply the hits in slot order, since each one is limited by the strength left over from the previous ones
+
+	land_combat_losses attacker_losses{ state.world.land_battle_get_attacker_infantry_lost(b), state.world.land_battle_get_attacker_cav_lost(b), state.world.land_battle_get_attacker_support_lost(b), 0.0f };
+	land_combat_losses defender_losses{ state.world.land_battle_get_defender_infantry_lost(b), state.world.land_battle_get_defender_cav_lost(b), state.world.land_battle_get_defender_support_lost(b), 0.0f };
+
+	for(int32_t i = 0; i < combat_width; ++i) {
+		if(att_back[i] && def_front[i]) {
+			apply_land_combat_hit(def_front_row, i, att_damage.back_str[i], att_damage.back_org[i], defender_losses);
+		}
+		if(def_back[i] && att_front[i]) {
+			apply_land_combat_hit(att_front_row, i, def_damage.back_str[i], def_damage.back_org[i], attacker_losses);
+		}
+		if(att_damage.front_target[i] >= 0) {
+			apply_land_combat_hit(def_front_row, att_damage.front_target[i], att_damage.front_str[i], att_damage.front_org[i], defender_losses);
+		}
+		if(def_damage.front_target[i] >= 0) {
+			apply_land_combat_hit(att_front_row, def_damage.front_target[i], def_damage.front_str[i], def_damage.front_org[i], attacker_losses);
+		}
+	}
+
+	scatter_land_combat_row(state, att_front, combat_width, att_front_row);
+	scatter_land_combat_row(state, def_front, combat_width, def_front_row);
+
+	state.world.land_battle_set_attacker_infantry_lost(b, attacker_losses.infantry);
+	state.world.land_battle_set_attacker_cav_lost(b, attacker_losses.cavalry);
+	state.world.land_battle_set_attacker_support_lost(b, attacker_losses.support);
+	state.world.land_battle_set_defender_infantry_lost(b, defender_losses.infantry);
+	state.world.land_battle_set_defender_cav_lost(b, defender_losses.cavalry);
+	state.world.land_battle_set_defender_support_lost(b, defender_losses.support);
+
+	state.world.land_battle_set_attacker_casualties(b, attacker_losses.casualties);
+	state.world.land_battle_set_defender_casualties(b, defender_losses.casualties);
+}
+
 void update_land_battles(sys::state& state) {
 	auto isize = state.world.land_battle_size();
 	auto to_delete = ve::vectorizable_buffer<uint8_t, dcon::land_battle_id>(isize);
@@ -5134,202 +5429,7 @@ void update_land_battles(sys::state& state) {
 		damage from attrition as well.
 		*/
 
-		state.world.land_battle_set_attacker_casualties(b, 0);
-		state.world.land_battle_set_defender_casualties(b, 0);
-
-		float attacker_casualties = 0;
-		float defender_casualties = 0;
-
-		for(int32_t i = 0; i < combat_width; ++i) {
-			if(att_back[i] && def_front[i]) {
-				assert(state.world.regiment_is_valid(att_back[i]) && state.world.regiment_is_valid(def_front[i]));
-
-				auto tech_att_nation = tech_nation_for_regiment(state, att_back[i]);
-				auto tech_def_nation = tech_nation_for_regiment(state, def_front[i]);
-
-				auto& att_stats = state.world.nation_get_unit_stats(tech_att_nation, state.world.regiment_get_type(att_back[i]));
-				auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(def_front[i]));
-
-				auto str_damage = str_dam_mul *
-						(att_stats.attack_or_gun_power * 0.1f + 1.0f) * att_stats.support * attacker_mod /
-						(defender_fort * (state.defines.base_military_tactics + state.world.nation_get_modifier_values(tech_def_nation, sys::national_mod_offsets::military_tactics)));
-				auto org_damage = org_dam_mul *
-						(att_stats.attack_or_gun_power * 0.1f + 1.0f) * att_stats.support * attacker_mod /
-						(defender_fort * defender_org_bonus * def_stats.discipline_or_evasion *
-								(1.0f + state.world.nation_get_modifier_values(tech_def_nation, sys::national_mod_offsets::land_organisation)));
-
-				auto& cstr = state.world.regiment_get_strength(def_front[i]);
-				str_damage = std::min(str_damage, cstr);
-				state.world.regiment_get_pending_damage(def_front[i]) += str_damage;
-				cstr -= str_damage;
-				defender_casualties += str_damage;
-
-				auto& org = state.world.regiment_get_org(def_front[i]);
-				org = std::max(0.0f, org - org_damage);
-				switch(state.military_definitions.unit_base_definitions[state.world.regiment_get_type(def_front[i])].type) {
-					case unit_type::infantry:
-						state.world.land_battle_get_defender_infantry_lost(b) += str_damage;
-						break;
-					case unit_type::cavalry:
-						state.world.land_battle_get_defender_cav_lost(b) += str_damage;
-						break;
-					case unit_type::support:
-						// fallthrough
-					case unit_type::special:
-						state.world.land_battle_get_defender_support_lost(b) += str_damage;
-						break;
-					default:
-						break;
-				}
-			}
-
-			if(def_back[i] && att_front[i]) {
-				assert(state.world.regiment_is_valid(def_back[i]) && state.world.regiment_is_valid(att_front[i]));
-
-				auto tech_def_nation = tech_nation_for_regiment(state, def_back[i]);
-				auto tech_att_nation = tech_nation_for_regiment(state, att_front[i]);
-
-				auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(def_back[i]));
-				auto& att_stats = state.world.nation_get_unit_stats(tech_att_nation, state.world.regiment_get_type(att_front[i]));
-
-				auto str_damage = str_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * def_stats.support * defender_mod / ((state.defines.base_military_tactics + state.world.nation_get_modifier_values(tech_att_nation, sys::national_mod_offsets::military_tactics)));
-				auto org_damage = org_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * def_stats.support * defender_mod / (attacker_org_bonus * def_stats.discipline_or_evasion * (1.0f + state.world.nation_get_modifier_values(tech_att_nation, sys::national_mod_offsets::land_organisation)));
-
-				auto& cstr = state.world.regiment_get_strength(att_front[i]);
-				str_damage = std::min(str_damage, cstr);
-				state.world.regiment_get_pending_damage(att_front[i]) += str_damage;
-				cstr -= str_damage;
-				attacker_casualties += str_damage;
-
-				auto& org = state.world.regiment_get_org(att_front[i]);
-				org = std::max(0.0f, org - org_damage);
-				switch(state.military_definitions.unit_base_definitions[state.world.regiment_get_type(att_front[i])].type) {
-					case unit_type::infantry:
-						state.world.land_battle_get_attacker_infantry_lost(b) += str_damage;
-						break;
-					case unit_type::cavalry:
-						state.world.land_battle_get_attacker_cav_lost(b) += str_damage;
-						break;
-					case unit_type::support:
-						// fallthrough
-					case unit_type::special:
-						state.world.land_battle_get_attacker_support_lost(b) += str_damage;
-						break;
-					default:
-						break;
-				}
-			}
-
-			if(att_front[i]) {
-				assert(state.world.regiment_is_valid(att_front[i]));
-
-				auto tech_att_nation = tech_nation_for_regiment(state, att_front[i]);
-				auto& att_stats = state.world.nation_get_unit_stats(tech_att_nation, state.world.regiment_get_type(att_front[i]));
-
-				auto att_front_target = def_front[i];
-				if(auto mv = state.military_definitions.unit_base_definitions[state.world.regiment_get_type(att_front[i])].maneuver; !att_front_target && mv > 0.0f) {
-					for(int32_t cnt = 1; i - cnt * 2 >= 0 && cnt <= int32_t(mv); ++cnt) {
-						if(def_front[i - cnt * 2]) {
-							att_front_target = def_front[i - cnt * 2];
-							break;
-						}
-					}
-				}
-
-				if(att_front_target) {
-					assert(state.world.regiment_is_valid(att_front_target));
-
-					auto tech_def_nation = tech_nation_for_regiment(state, att_front_target);
-					auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(att_front_target));
-
-					auto str_damage = str_dam_mul *
-							(att_stats.attack_or_gun_power * 0.1f + 1.0f) * attacker_mod /
-							(defender_fort * (state.defines.base_military_tactics + state.world.nation_get_modifier_values(tech_def_nation, sys::national_mod_offsets::military_tactics)));
-					auto org_damage = org_dam_mul *
-							(att_stats.attack_or_gun_power * 0.1f + 1.0f) * attacker_mod /
-							(defender_fort * def_stats.discipline_or_evasion * defender_org_bonus * (1.0f + state.world.nation_get_modifier_values(tech_def_nation, sys::national_mod_offsets::land_organisation)));
-
-					auto& cstr = state.world.regiment_get_strength(att_front_target);
-					str_damage = std::min(str_damage, cstr);
-					state.world.regiment_get_pending_damage(att_front_target) += str_damage;
-					cstr -= str_damage;
-					defender_casualties += str_damage;
-
-					auto& org = state.world.regiment_get_org(att_front_target);
-					org = std::max(0.0f, org - org_damage);
-					switch(state.military_definitions.unit_base_definitions[state.world.regiment_get_type(att_front_target)].type) {
-						case unit_type::infantry:
-							state.world.land_battle_get_defender_infantry_lost(b) += str_damage;
-							break;
-						case unit_type::cavalry:
-							state.world.land_battle_get_defender_cav_lost(b) += str_damage;
-							break;
-						case unit_type::support:
-							// fallthrough
-						case unit_type::special:
-							state.world.land_battle_get_defender_support_lost(b) += str_damage;
-							break;
-						default:
-							break;
-					}
-				}
-			}
-
-			if(def_front[i]) {
-				assert(state.world.regiment_is_valid(def_front[i]));
-
-				auto tech_def_nation = tech_nation_for_regiment(state, def_front[i]);
-				auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(def_front[i]));
-
-				auto def_front_target = att_front[i];
-
-				if(auto mv = state.military_definitions.unit_base_definitions[state.world.regiment_get_type(def_front[i])].maneuver; !def_front_target && mv > 0.0f) {
-					for(int32_t cnt = 1; i - cnt * 2 >= 0 && cnt <= int32_t(mv); ++cnt) {
-						if(att_front[i - cnt * 2]) {
-							def_front_target = att_front[i - cnt * 2];
-							break;
-						}
-					}
-				}
-
-				if(def_front_target) {
-					assert(state.world.regiment_is_valid(def_front_target));
-
-					auto tech_att_nation = tech_nation_for_regiment(state, def_front_target);
-					auto& att_stats = state.world.nation_get_unit_stats(tech_att_nation, state.world.regiment_get_type(def_front_target));
-
-					auto str_damage = str_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * defender_mod / ((state.defines.base_military_tactics + state.world.nation_get_modifier_values(tech_att_nation, sys::national_mod_offsets::military_tactics)));
-					auto org_damage = org_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * defender_mod / (attacker_org_bonus * def_stats.discipline_or_evasion * (1.0f + state.world.nation_get_modifier_values(tech_att_nation, sys::national_mod_offsets::land_organisation)));
-
-					auto& cstr = state.world.regiment_get_strength(def_front_target);
-					str_damage = std::min(str_damage, cstr);
-					state.world.regiment_get_pending_damage(def_front_target) += str_damage;
-					cstr -= str_damage;
-					attacker_casualties += str_damage;
-
-					auto& org = state.world.regiment_get_org(def_front_target);
-					org = std::max(0.0f, org - org_damage);
-					switch(state.military_definitions.unit_base_definitions[state.world.regiment_get_type(def_front_target)].type) {
-						case unit_type::infantry:
-							state.world.land_battle_get_attacker_infantry_lost(b) += str_damage;
-							break;
-						case unit_type::cavalry:
-							state.world.land_battle_get_attacker_cav_lost(b) += str_damage;
-							break;
-						case unit_type::support:
-							// fallthrough
-						case unit_type::special:
-							state.world.land_battle_get_attacker_support_lost(b) += str_damage;
-							break;
-						default:
-							break;
-					}
-				}
-			}
-		}
-
-		state.world.land_battle_set_attacker_casualties(b, attacker_casualties);
-		state.world.land_battle_set_defender_casualties(b, defender_casualties);
+		apply_land_combat_damage(state, b, land_combat_modifiers{ attacker_mod, defender_mod, defender_fort, attacker_org_bonus, defender_org_bonus });
 
 
 		// clear dead / retreated regiments out
@@ -5952,7 +6052,7 @@ void update_movement(sys::state& state) {
 				// check for embarkation possibility, then embark
 				auto to_navy = find_embark_target(state, a.get_controller_from_army_control(), dest, a);
 				if(to_navy) {
-					a.set_location_from_army_location(dest);
+					set_army_location(state, a, dest);
 					a.set_navy_from_army_transport(to_navy);
 					a.set_black_flag(false);
 				} else {
@@ -6072,7 +6172,7 @@ void update_movement(sys::state& state) {
 
 						if(acontroller && !acontroller.get_is_player_controlled()) {
 							auto army_dest = a.get_ai_province();
-							a.set_location_from_army_location(dest);
+							set_army_location(state, a, dest);
 							if(army_dest && army_dest != dest) {
 								auto apath = province::make_land_path(state, dest, army_dest, acontroller, a);
 								if(apath.size() > 0) {
@@ -6109,7 +6209,7 @@ void update_movement(sys::state& state) {
 
 				// take embarked units along with
 				for(auto a : state.world.navy_get_army_transport(n)) {
-					a.get_army().set_location_from_army_location(dest);
+					set_army_location(state, a.get_army(), dest);
 					a.get_army().get_path().clear();
 					a.get_army().set_arrival_time(sys::date{});
 				}
@@ -6290,52 +6390,55 @@ void update_siege_progress(sys::state& state) {
 
 		dcon::army_id first_army;
 
-		for(auto ar : state.world.province_get_army_location(prov)) {
-			// Only stationary, non black flagged regiments with at least 0.001 strength contribute to a siege.
-
-			if(ar.get_army().get_battle_from_army_battle_participation() || ar.get_army().get_black_flag() ||
-					ar.get_army().get_navy_from_army_transport() || ar.get_army().get_arrival_time()) {
+		// only walk the armies here when at least one of them is hostile to the controller
+		if(has_hostile_army_in_province(state, prov, controller)) {
+			for(auto ar : state.world.province_get_army_location(prov)) {
+				// Only stationary, non black flagged regiments with at least 0.001 strength contribute to a siege.
 
-				// skip -- blackflag or embarked or moving or fighting
-			} else {
-				bool will_siege = false;
+				if(ar.get_army().get_battle_from_army_battle_participation() || ar.get_army().get_black_flag() ||
+						ar.get_army().get_navy_from_army_transport() || ar.get_army().get_arrival_time()) {
 
-				auto army_controller = ar.get_army().get_controller_from_army_control();
-				if(!army_controller) {					 // rebel army
-					will_siege = bool(controller); // siege anything not rebel controlled
+					// skip -- blackflag or embarked or moving or fighting
 				} else {
-					if(!controller) {
-						will_siege = true; // siege anything rebel controlled
-					} else if(are_at_war(state, controller, army_controller)) {
-						will_siege = true;
+					bool will_siege = false;
+
+					auto army_controller = ar.get_army().get_controller_from_army_control();
+					if(!army_controller) {					 // rebel army
+						will_siege = bool(controller); // siege anything not rebel controlled
+					} else {
+						if(!controller) {
+							will_siege = true; // siege anything rebel controlled
+						} else if(are_at_war(state, controller, army_controller)) {
+							will_siege = true;
+						}
 					}
-				}
 
-				if(will_siege) {
-					if(!first_army)
-						first_army = ar.get_army();
+					if(will_siege) {
+						if(!first_army)
+							first_army = ar.get_army();
 
-					auto army_stats = army_controller ? army_controller : ar.get_army().get_army_rebel_control().get_controller().get_ruler_from_rebellion_within();
+						auto army_stats = army_controller ? army_controller : ar.get_army().get_army_rebel_control().get_controller().get_ruler_from_rebellion_within();
 
-					owner_involved = owner_involved || owner == army_controller;
-					core_owner_involved =
-							core_owner_involved || bool(state.world.get_core_by_prov_tag_key(prov,  state.world.nation_get_identity_from_identity_holder(army_controller)));
+						owner_involved = owner_involved || owner == army_controller;
+						core_owner_involved =
+								core_owner_involved || bool(state.world.get_core_by_prov_tag_key(prov,  state.world.nation_get_identity_from_identity_holder(army_controller)));
 
-					for(auto r : ar.get_army().get_army_membership()) {
-						auto reg_str = r.get_regiment().get_strength();
-						if(reg_str > 0.001f) {
-							auto type = r.get_regiment().get_type();
-							auto& stats = state.world.nation_get_unit_stats(army_stats, type);
+						for(auto r : ar.get_army().get_army_membership()) {
+							auto reg_str = r.get_regiment().get_strength();
+							if(reg_str > 0.001f) {
+								auto type = r.get_regiment().get_type();
+								auto& stats = state.world.nation_get_unit_stats(army_stats, type);
 
-							total_sieging_strength += reg_str;
+								total_sieging_strength += reg_str;
 
-							if(stats.siege_or_torpedo_attack > 0.0f) {
-								strength_siege_units += reg_str;
-								max_siege_value = std::max(max_siege_value, stats.siege_or_torpedo_attack);
-							}
-							if(stats.reconnaissance_or_fire_range > 0.0f) {
-								strength_recon_units += reg_str;
-								max_recon_value = std::max(max_recon_value, stats.reconnaissance_or_fire_range);
+								if(stats.siege_or_torpedo_attack > 0.0f) {
+									strength_siege_units += reg_str;
+									max_siege_value = std::max(max_siege_value, stats.siege_or_torpedo_attack);
+								}
+								if(stats.reconnaissance_or_fire_range > 0.0f) {
+									strength_recon_units += reg_str;
+									max_recon_value = std::max(max_recon_value, stats.reconnaissance_or_fire_range);
+								}
 							}
 						}
 					}
@@ -6539,7 +6642,7 @@ void eject_ships(sys::state& state, dcon::province_id p) {
 		navy_arrives_in_province(state, n, sea_zone, dcon::naval_battle_id{});
 
 		for(auto a : state.world.navy_get_army_transport(n)) {
-			a.get_army().set_location_from_army_location(sea_zone);
+			set_army_location(state, a.get_army(), sea_zone);
 			a.get_army().get_path().clear();
 			a.get_army().set_arrival_time(sys::date{});
 		}
@@ -7057,6 +7160,8 @@ void update_blackflag_status(sys::state& state) {
 }
 
 bool rebel_army_in_province(sys::state& state, dcon::province_id p) {
+	if(army_count_in_province(state, p, dcon::nation_id{}) == 0) // rebel armies are indexed with no controlling nation
+		return false;
 	for(auto ar : state.world.province_get_army_location(p)) {
 		if(ar.get_army().get_controller_from_army_rebel_control())
 			return true;
@@ -136,6 +136,11 @@ static_assert(sizeof(unit_definition) ==
 	+ sizeof(unit_definition::type)
 	+ sizeof(unit_definition::padding));
 
+struct army_presence {
+	dcon::nation_id controller; // invalid for armies controlled by rebels or by no one
+	uint16_t count = 0;
+};
+
 struct global_military_state {
 	tagged_vector<unit_definition, dcon::unit_type_id> unit_base_definitions;
 
@@ -163,6 +168,8 @@ struct global_military_state {
 	dcon::unit_type_id artillery;
 
 	bool pending_blackflag_update = false;
+
+	tagged_vector<std::vector<army_presence>, dcon::province_id> army_presence_by_province; // derived, not saved
 };
 
 struct available_cb {
@@ -262,6 +269,13 @@ void reset_unit_stats(sys::state& state);
 void apply_base_unit_stat_modifiers(sys::state& state);
 void restore_unsaved_values(sys::state& state); // must run after determining connectivity
 
+// index of which controllers have armies in each province: kept up to date by set_army_location and cleanup_army
+void rebuild_army_location_index(sys::state& state);
+void set_army_location(sys::state& state, dcon::army_id a, dcon::province_id p);
+int32_t army_count_in_province(sys::state const& state, dcon::province_id p, dcon::nation_id controller);
+// armies that would siege a province controlled by n (any nation's army when n is invalid, i.e. rebel controlled)
+bool has_hostile_army_in_province(sys::state const& state, dcon::province_id p, dcon::nation_id n);
+
 bool are_at_war(sys::state const& state, dcon::nation_id a, dcon::nation_id b);
 bool are_allied_in_war(sys::state const& state, dcon::nation_id a, dcon::nation_id b);
 bool are_in_common_war(sys::state const& state, dcon::nation_id a, dcon::nation_id b);
@@ -447,6 +461,15 @@ void eject_ships(sys::state& state, dcon::province_id p);
 void update_movement(sys::state& state);
 void update_siege_progress(sys::state& state);
 void update_naval_battles(sys::state& state);
+// per-battle values that scale the damage dealt across the frontage
+struct land_combat_modifiers {
+	float attacker_mod = 1.0f;
+	float defender_mod = 1.0f;
+	float defender_fort = 1.0f;
+	float attacker_org_bonus = 1.0f;
+	float defender_org_bonus = 1.0f;
+};
+void apply_land_combat_damage(sys::state& state, dcon::land_battle_id b, land_combat_modifiers const& mods);
 void update_land_battles(sys::state& state);
 void apply_regiment_damage(sys::state& state);
 void apply_attrition(sys::state& state);
@@ -877,9 +877,9 @@ bool has_decision_available(sys::state& state, dcon::nation_id n) {
 		dcon::decision_id did{dcon::decision_id::value_base_t(i)};
 		if(!state.world.decision_get_hide_notification(did)) {
 			auto lim = state.world.decision_get_potential(did);
-			if(!lim || trigger::evaluate(state, lim, trigger::to_generic(n), trigger::to_generic(n), 0)) {
+			if(!lim || trigger::evaluate_cached(state, lim, trigger::to_generic(n), trigger::to_generic(n), 0)) {
 				auto allow = state.world.decision_get_allow(did);
-				if(!allow || trigger::evaluate(state, allow, trigger::to_generic(n), trigger::to_generic(n), 0)) {
+				if(!allow || trigger::evaluate_cached(state, allow, trigger::to_generic(n), trigger::to_generic(n), 0)) {
 					return true;
 				}
 			}
@@ -1300,6 +1300,7 @@ void cleanup_nation(sys::state& state, dcon::nation_id n) {
 
 	// transfer flags and variables to new holder
 	state.world.delete_nation(n);
+	military::rebuild_army_location_index(state); // any armies left behind are no longer controlled by n
 	auto new_ident_holder = state.world.create_nation();
 	state.world.try_create_identity_holder(new_ident_holder, old_ident);
 
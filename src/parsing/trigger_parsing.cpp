@@ -784,6 +784,68 @@ bool scope_has_single_member(uint16_t const* source) {
 	return trigger::get_trigger_scope_payload_size(source) == data_offset + trigger::get_trigger_payload_size(source + data_offset);
 }
 
+// yields 1 or 0 for triggers that always evaluate to true or false, and -1 for anything that depends on the game state
+int32_t constant_trigger_value(uint16_t const* source) {
+	if((source[0] & trigger::code_mask) != trigger::always)
+		return -1;
+	switch(source[0] & trigger::association_mask) {
+	case trigger::association_eq:
+	case trigger::association_ge:
+	case trigger::association_le:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+// precondition: source is a flattened generic scope; yields new source size
+int32_t fold_generic_scope_members(uint16_t* source, int32_t source_size) {
+	auto const first_member = source + 2;
+	// a true member decides an or scope, a false member decides an and scope
+	auto const deciding_value = (source[0] & trigger::is_disjunctive_scope) != 0 ? 1 : 0;
+
+	bool has_variable_member = false;
+	for(auto sub_units_start = first_member; sub_units_start < source + source_size; sub_units_start += 1 + trigger::get_trigger_payload_size(sub_units_start)) {
+		auto const value = constant_trigger_value(sub_units_start);
+		if(value == deciding_value) {
+			source[0] = sub_units_start[0];
+			return 1;
+		}
+		has_variable_member = has_variable_member || value == -1;
+	}
+	if(!has_variable_member && deciding_value == 1 && source_size > 2) {
+		// an or scope made only of false members must not collapse into an empty (always true) scope
+		source[0] = uint16_t(trigger::always | trigger::no_payload | trigger::association_ne);
+		return 1;
+	}
+	if(!has_variable_member && deciding_value == 0 && source_size > 2) {
+		// an and scope made only of true members must not collapse into nothing, which an enclosing or scope would drop
+		source[0] = uint16_t(trigger::always | trigger::no_payload | trigger::association_eq);
+		return 1;
+	}
+
+	// drop members that can't change the result, as well as repeats of an earlier member
+	auto sub_units_start = first_member;
+	while(sub_units_start < source + source_size) {
+		auto const size = 1 + trigger::get_trigger_payload_size(sub_units_start);
+		bool redundant = constant_trigger_value(sub_units_start) != -1;
+		for(auto prev = first_member; !redundant && prev < sub_units_start; prev += 1 + trigger::get_trigger_payload_size(prev)) {
+			redundant = (1 + trigger::get_trigger_payload_size(prev)) == size && std::equal(prev, prev + size, sub_units_start);
+		}
+		if(redundant) {
+			std::copy(sub_units_start + size, source + source_size, sub_units_start);
+			source_size -= size;
+		} else {
+			sub_units_start += size;
+		}
+	}
+	source[1] = uint16_t(source_size - 1);
+
+	// the members are left in the authored order, which is the order the tooltips list them in; the copy that is
+	// evaluated gets its members sorted by cost when the trigger is committed (see trigger::order_members_by_cost)
+	return source_size;
+}
+
 // yields new source size
 int32_t simplify_trigger(uint16_t* source) {
 	assert((0 <= (*source & trigger::code_mask) && (*source & trigger::code_mask) < trigger::first_invalid_code) ||
@@ -838,6 +900,8 @@ int32_t simplify_trigger(uint16_t* source) {
 				}
 			}
 			source[1] = uint16_t(source_size - 1);
+
+			source_size = fold_generic_scope_members(source, source_size);
 		}
 
 		if((source[0] & trigger::code_mask) >= trigger::first_scope_code && scope_has_single_member(source)) {
@@ -874,6 +938,37 @@ dcon::trigger_key make_trigger(token_generator& gen, error_handler& err, trigger
 	return context.outer_context.state.commit_trigger_data(context.compiled_trigger);
 }
 
+std::string expensive_triggers_report(sys::state& state, size_t count) {
+	struct entry {
+		float cost;
+		std::string source;
+	};
+	std::vector<entry> entries;
+	auto add_trigger = [&](dcon::trigger_key k, std::string source) {
+		if(k) {
+			entries.push_back(entry{ trigger::estimate_cost(state.trigger_data.data() + state.trigger_data_indices[k.index() + 1]), std::move(source) });
+		}
+	};
+	for(auto d : state.world.in_decision) {
+		auto name = text::produce_simple_string(state, d.get_name());
+		add_trigger(d.get_potential(), "decision " + name + " (potential)");
+		add_trigger(d.get_allow(), "decision " + name + " (allow)");
+	}
+	for(auto e : state.world.in_free_national_event) {
+		add_trigger(e.get_trigger(), "national event " + std::to_string(e.get_legacy_id()) + " " + text::produce_simple_string(state, e.get_name()));
+	}
+	for(auto e : state.world.in_free_provincial_event) {
+		add_trigger(e.get_trigger(), "provincial event " + text::produce_simple_string(state, e.get_name()));
+	}
+
+	std::sort(entries.begin(), entries.end(), [](entry const& a, entry const& b) { return a.cost > b.cost; });
+	std::string result;
+	for(size_t i = 0; i < std::min(count, entries.size()); ++i) {
+		result += std::to_string(int32_t(entries[i].cost)) + "\t" + entries[i].source + "\n";
+	}
+	return result;
+}
+
 void make_stored_trigger(std::string_view name, token_generator& gen, error_handler& err, scenario_building_context& context) {
 	trigger_building_context tcontext{ context , trigger::slot_contents::empty, trigger::slot_contents::empty , trigger::slot_contents::empty };
 
@@ -5924,6 +5924,8 @@ void invert_trigger(uint16_t* source);
 bool scope_is_empty(uint16_t const* source);
 bool scope_has_single_member(uint16_t const* source);
 int32_t simplify_trigger(uint16_t* source);
+// lists the triggers with the highest estimated cost per evaluation, most expensive first
+std::string expensive_triggers_report(sys::state& state, size_t count);
 dcon::trigger_key make_trigger(token_generator& gen, error_handler& err, trigger_building_context& context);
 
 struct value_modifier_definition {
@@ -26,60 +26,148 @@ bool nations_are_adjacent(sys::state& state, dcon::nation_id a, dcon::nation_id
 	auto it = state.world.get_nation_adjacency_by_nation_adjacency_pair(a, b);
 	return bool(it);
 }
-void update_connected_regions(sys::state& state) {
-	if(!state.adjacency_data_out_of_date)
-		return;
+// to_fill_list is scratch space owned by the caller, so that a whole rebuild reuses one allocation
+static void flood_connected_region(sys::state& state, dcon::province_id start, uint16_t fill_id, std::vector<dcon::province_id>& to_fill_list) {
+	bool found_coast = false;
+	to_fill_list.push_back(start);
+
+	while(!to_fill_list.empty()) {
+		auto current_id = to_fill_list.back();
+		to_fill_list.pop_back();
+
+		found_coast = found_coast || state.world.province_get_is_coast(current_id);
+
+		state.world.province_set_connected_region_id(current_id, fill_id);
+		auto owner_a = state.world.province_get_nation_from_province_ownership(current_id);
+		for(auto& nb : adjacent_provinces(state, current_id)) {
+			if((nb.type & (province::border::coastal_bit | province::border::impassible_bit)) ==
+					0) { // not entering sea, not impassible
+				auto owner_b = state.world.province_get_nation_from_province_ownership(nb.province);
+				if(owner_a == owner_b) { // both have the same owner
+					if(state.world.province_get_connected_region_id(nb.province) == 0)
+						to_fill_list.push_back(nb.province);
+				}
+			}
+		}
+	}
 
-	state.adjacency_data_out_of_date = false;
+	if(fill_id > state.province_definitions.connected_region_is_coastal.size())
+		state.province_definitions.connected_region_is_coastal.resize(fill_id, false);
+	state.province_definitions.connected_region_is_coastal[fill_id - 1] = found_coast;
+	to_fill_list.clear();
+}
 
+static void add_nation_adjacencies_from(sys::state& state, dcon::province_id p) {
+	auto owner_a = state.world.province_get_nation_from_province_ownership(p);
+	for(auto& nb : adjacent_provinces(state, p)) {
+		if((nb.type & (province::border::coastal_bit | province::border::impassible_bit)) == 0) {
+			auto owner_b = state.world.province_get_nation_from_province_ownership(nb.province);
+			if(owner_a != owner_b)
+				state.world.try_create_nation_adjacency(owner_a, owner_b);
+		}
+	}
+}
+
+/*
+The nation adjacency lists are read in order (e.g. by the random neighbor scopes and the AI), so they must come out
+the same no matter which path rebuilt them. Deleting single adjacencies would compact the relation and shuffle the
+ids and list positions of unrelated nations, so both paths clear it and rebuild it in province order.
+*/
+static void rebuild_nation_adjacencies(sys::state& state) {
 	state.world.nation_adjacency_resize(0);
+	for(int32_t i = 0; i < state.province_definitions.first_sea_province.index(); ++i) {
+		add_nation_adjacencies_from(state, dcon::province_id{dcon::province_id::value_base_t(i)});
+	}
+}
 
+static void rebuild_all_connected_regions(sys::state& state) {
 	state.world.for_each_province([&](dcon::province_id id) { state.world.province_set_connected_region_id(id, 0); });
-	// TODO get a better allocator
-	static std::vector<dcon::province_id> to_fill_list;
 	uint16_t current_fill_id = 0;
 	state.province_definitions.connected_region_is_coastal.clear();
 
+	std::vector<dcon::province_id> to_fill_list;
 	to_fill_list.reserve(state.world.province_size());
-
 	for(int32_t i = state.province_definitions.first_sea_province.index(); i-- > 0;) {
 		dcon::province_id id{dcon::province_id::value_base_t(i)};
 		if(state.world.province_get_connected_region_id(id) == 0) {
 			++current_fill_id;
+			flood_connected_region(state, id, current_fill_id, to_fill_list);
+		}
+	}
 
-			bool found_coast = false;
-
-			to_fill_list.push_back(id);
+	rebuild_nation_adjacencies(state);
+}
 
-			while(!to_fill_list.empty()) {
-				auto current_id = to_fill_list.back();
-				to_fill_list.pop_back();
+/*
+Only the regions touched by the pending ownership changes are re-flooded: the old region of each changed province
+(which may have split) and the regions of its same-owner neighbors (which may have merged with it). Region ids are
+only ever compared with each other, so the ids of the dirty regions are simply recycled. The nation adjacencies
+are cheap next to the flood and are rebuilt in full (see above). Changes that involve unowned provinces fall back
+to the full rebuild, as do large batches of changes.
+*/
+static bool update_connected_regions_incrementally(sys::state& state) {
+	auto& changes = state.province_definitions.pending_owner_changes;
+	auto land_count = state.province_definitions.first_sea_province.index();
+	auto& coastal = state.province_definitions.connected_region_is_coastal;
 
-				found_coast = found_coast || state.world.province_get_is_coast(current_id);
+	if(changes.empty() || coastal.empty() || state.province_definitions.pending_unowned_change ||
+			int32_t(changes.size()) * 16 > land_count)
+		return false;
 
-				state.world.province_set_connected_region_id(current_id, current_fill_id);
-				for(auto rel : state.world.province_get_province_adjacency(current_id)) {
-					if((rel.get_type() & (province::border::coastal_bit | province::border::impassible_bit)) ==
-							0) { // not entering sea, not impassible
-						auto owner_a = rel.get_connected_provinces(0).get_nation_from_province_ownership();
-						auto owner_b = rel.get_connected_provinces(1).get_nation_from_province_ownership();
-						if(owner_a == owner_b) { // both have the same owner
-							if(rel.get_connected_provinces(0).get_connected_region_id() == 0)
-								to_fill_list.push_back(rel.get_connected_provinces(0));
-							if(rel.get_connected_provinces(1).get_connected_region_id() == 0)
-								to_fill_list.push_back(rel.get_connected_provinces(1));
-						} else {
-							state.world.try_create_nation_adjacency(owner_a, owner_b);
-						}
-					}
-				}
+	std::vector<bool> region_is_dirty(coastal.size() + 1, false);
+	for(auto p : changes) {
+		if(p.index() >= land_count)
+			continue;
+		auto owner = state.world.province_get_nation_from_province_ownership(p);
+		region_is_dirty[state.world.province_get_connected_region_id(p)] = true;
+		for(auto& nb : adjacent_provinces(state, p)) {
+			if((nb.type & (province::border::coastal_bit | province::border::impassible_bit)) == 0 &&
+					state.world.province_get_nation_from_province_ownership(nb.province) == owner) {
+				region_is_dirty[state.world.province_get_connected_region_id(nb.province)] = true;
 			}
+		}
+	}
 
-			state.province_definitions.connected_region_is_coastal.push_back(found_coast);
-			to_fill_list.clear();
+	std::vector<uint16_t> free_ids;
+	for(uint32_t i = uint32_t(region_is_dirty.size()); i-- > 1;) {
+		if(region_is_dirty[i])
+			free_ids.push_back(uint16_t(i));
+	}
+	for(int32_t i = 0; i < land_count; ++i) {
+		dcon::province_id id{dcon::province_id::value_base_t(i)};
+		if(region_is_dirty[state.world.province_get_connected_region_id(id)])
+			state.world.province_set_connected_region_id(id, 0);
+	}
+	std::vector<dcon::province_id> to_fill_list;
+	for(int32_t i = land_count; i-- > 0;) {
+		dcon::province_id id{dcon::province_id::value_base_t(i)};
+		if(state.world.province_get_connected_region_id(id) == 0) {
+			uint16_t fill_id = 0;
+			if(!free_ids.empty()) {
+				fill_id = free_ids.back();
+				free_ids.pop_back();
+			} else {
+				fill_id = uint16_t(coastal.size() + 1);
+			}
+			flood_connected_region(state, id, fill_id, to_fill_list);
 		}
 	}
 
+	rebuild_nation_adjacencies(state);
+	return true;
+}
+
+void update_connected_regions(sys::state& state) {
+	if(!state.adjacency_data_out_of_date)
+		return;
+
+	state.adjacency_data_out_of_date = false;
+
+	if(!update_connected_regions_incrementally(state))
+		rebuild_all_connected_regions(state);
+	state.province_definitions.pending_owner_changes.clear();
+	state.province_definitions.pending_unowned_change = false;
+
 	// we also invalidate wargoals here that are now unowned
 	military::invalidate_unowned_wargoals(state);
 
@@ -252,13 +340,147 @@ void restore_cached_values(sys::state& state) {
 	});
 }
 
+// the per-nation version of the above: only touches n, its provinces and its state instances
+static void restore_cached_values(sys::state& state, dcon::nation_id n) {
+	state.world.nation_set_central_province_count(n, uint16_t(0));
+	state.world.nation_set_central_blockaded(n, uint16_t(0));
+	state.world.nation_set_central_rebel_controlled(n, uint16_t(0));
+	state.world.nation_set_rebel_controlled_count(n, uint16_t(0));
+	state.world.nation_set_central_ports(n, uint16_t(0));
+	state.world.nation_set_central_crime_count(n, uint16_t(0));
+	state.world.nation_set_total_ports(n, uint16_t(0));
+	state.world.nation_set_occupied_count(n, uint16_t(0));
+	state.world.nation_set_owned_state_count(n, uint16_t(0));
+	state.world.nation_set_is_colonial_nation(n, false);
+
+	auto orange = state.world.nation_get_province_ownership(n);
+	state.world.nation_set_owned_province_count(n, uint16_t(orange.end() - orange.begin()));
+
+	for(auto po : orange) {
+		bool owner_core = false;
+		for(auto c : po.get_province().get_core()) {
+			if(c.get_identity().get_nation_from_identity_holder() == n) {
+				owner_core = true;
+				break;
+			}
+		}
+		po.get_province().set_is_owner_core(owner_core);
+	}
+
+	if(state.world.province_get_nation_from_province_ownership(state.world.nation_get_capital(n)) != n) {
+		state.world.nation_set_capital(n, pick_capital(state, n));
+	}
+
+	for(auto po : orange) {
+		auto pid = po.get_province().id;
+		if(pid.index() >= state.province_definitions.first_sea_province.index())
+			continue;
+
+		bool reb_controlled = bool(state.world.province_get_rebel_faction_from_province_rebel_control(pid));
+
+		if(reb_controlled) {
+			state.world.nation_get_rebel_controlled_count(n) += uint16_t(1);
+		}
+		if(state.world.province_get_is_coast(pid)) {
+			state.world.nation_get_total_ports(n) += uint16_t(1);
+		}
+		if(auto c = state.world.province_get_nation_from_province_control(pid); bool(c) && c != n) {
+			state.world.nation_get_occupied_count(n) += uint16_t(1);
+		}
+		if(state.world.province_get_is_colonial(pid)) {
+			state.world.nation_set_is_colonial_nation(n, true);
+		}
+		if(!is_overseas(state, pid)) {
+			state.world.nation_get_central_province_count(n) += uint16_t(1);
+
+			if(military::province_is_blockaded(state, pid)) {
+				state.world.nation_get_central_blockaded(n) += uint16_t(1);
+			}
+			if(state.world.province_get_is_coast(pid)) {
+				state.world.nation_get_central_ports(n) += uint16_t(1);
+			}
+			if(reb_controlled) {
+				state.world.nation_get_central_rebel_controlled(n) += uint16_t(1);
+			}
+			if(state.world.province_get_crime(pid)) {
+				state.world.nation_get_central_crime_count(n) += uint16_t(1);
+			}
+		}
+	}
+
+	for(auto so : state.world.nation_get_state_ownership(n)) {
+		auto s = so.get_state();
+		state.world.nation_get_owned_state_count(n) += uint16_t(1);
+		dcon::province_id p;
+		for(auto prv : s.get_definition().get_abstract_state_membership()) {
+			if(prv.get_province().get_nation_from_province_ownership() == n) {
+				p = prv.get_province().id;
+				break;
+			}
+		}
+		s.set_capital(p);
+	}
+}
+
+#ifndef NDEBUG
+struct national_cached_snapshot {
+	dcon::nation_id n;
+	dcon::province_id capital;
+	uint16_t values[10];
+	bool is_colonial_nation;
+};
+static national_cached_snapshot snapshot_cached_values(sys::state& state, dcon::nation_id n) {
+	return national_cached_snapshot{n, state.world.nation_get_capital(n),
+		{state.world.nation_get_owned_province_count(n), state.world.nation_get_central_province_count(n),
+			state.world.nation_get_central_blockaded(n), state.world.nation_get_central_rebel_controlled(n),
+			state.world.nation_get_rebel_controlled_count(n), state.world.nation_get_central_ports(n),
+			state.world.nation_get_central_crime_count(n), state.world.nation_get_total_ports(n),
+			state.world.nation_get_occupied_count(n), state.world.nation_get_owned_state_count(n)},
+		state.world.nation_get_is_colonial_nation(n)};
+}
+#endif
+
 void update_cached_values(sys::state& state) {
 	if(!state.national_cached_values_out_of_date)
 		return;
 
 	state.national_cached_values_out_of_date = false;
 
+	auto& dirty = state.nations_with_cached_values_out_of_date;
+	std::sort(dirty.begin(), dirty.end(), [](auto a, auto b) { return a.index() < b.index(); });
+	dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+	// falls back to the full rebuild when the flag was raised without saying which nations changed,
+	// or when so many changed that walking them one by one is no cheaper
+	if(dirty.empty() || dirty.size() * 4 > state.world.nation_size()) {
+		restore_cached_values(state);
+		dirty.clear();
+		return;
+	}
+
+	for(auto n : dirty) {
+		if(state.world.nation_is_valid(n))
+			restore_cached_values(state, n);
+	}
+
+#ifndef NDEBUG
+	// check the incremental result for the nations we touched against the full rebuild (which debug builds then keep)
+	static std::vector<national_cached_snapshot> incremental;
+	incremental.clear();
+	for(auto n : dirty) {
+		if(state.world.nation_is_valid(n))
+			incremental.push_back(snapshot_cached_values(state, n));
+	}
 	restore_cached_values(state);
+	for(auto& v : incremental) {
+		auto full = snapshot_cached_values(state, v.n);
+		assert(full.capital == v.capital);
+		assert(std::equal(std::begin(full.values), std::end(full.values), std::begin(v.values)));
+		assert(full.is_colonial_nation == v.is_colonial_nation);
+	}
+#endif
+
+	dirty.clear();
 }
 
 void update_blockaded_cache(sys::state& state) {
@@ -281,9 +503,9 @@ void restore_unsaved_values(sys::state& state) {
 	for(int32_t i = 0; i < state.province_definitions.first_sea_province.index(); ++i) {
 		dcon::province_id pid{dcon::province_id::value_base_t(i)};
 
-		for(auto adj : state.world.province_get_province_adjacency(pid)) {
-			if((state.world.province_adjacency_get_type(adj) & province::border::coastal_bit) != 0 &&
-					(state.world.province_adjacency_get_type(adj) & province::border::impassible_bit) == 0) {
+		for(auto& nb : adjacent_provinces(state, pid)) {
+			if((nb.type & province::border::coastal_bit) != 0 &&
+					(nb.type & province::border::impassible_bit) == 0) {
 				state.world.province_set_is_coast(pid, true);
 				break;
 			}
@@ -672,7 +894,15 @@ void change_province_owner(sys::state& state, dcon::province_id id, dcon::nation
 		return;
 
 	state.adjacency_data_out_of_date = true;
+	state.province_definitions.pending_owner_changes.push_back(id);
+	state.province_definitions.pending_unowned_change = state.province_definitions.pending_unowned_change || !old_owner || !new_owner;
 	state.national_cached_values_out_of_date = true;
+	if(old_owner)
+		state.nations_with_cached_values_out_of_date.push_back(old_owner);
+	if(new_owner)
+		state.nations_with_cached_values_out_of_date.push_back(new_owner);
+	else
+		state.world.province_set_is_owner_core(id, false);
 
 	bool state_is_new = false;
 	dcon::state_instance_id new_si;
@@ -883,6 +1113,7 @@ void change_province_owner(sys::state& state, dcon::province_id id, dcon::nation
 		} else {
 			adj.set_type(adj.get_type() | province::border::national_bit);
 		}
+		update_adjacency_type(state, adj);
 	}
 
 	/* Properly cleanup rebels when the province ownership changes */
@@ -1081,9 +1312,8 @@ bool state_borders_nation(sys::state& state, dcon::nation_id n, dcon::state_inst
 	auto owner = state.world.state_instance_get_nation_from_state_ownership(si);
 	for(auto p : state.world.state_definition_get_abstract_state_membership(d)) {
 		if(p.get_province().get_nation_from_province_ownership() == owner) {
-			for(auto adj : p.get_province().get_province_adjacency()) {
-				auto indx = adj.get_connected_provinces(0) != p.get_province() ? 0 : 1;
-				auto o = adj.get_connected_provinces(indx).get_nation_from_province_ownership();
+			for(auto& nb : adjacent_provinces(state, p.get_province())) {
+				auto o = fatten(state.world, nb.province).get_nation_from_province_ownership();
 				if(o == n)
 					return true;
 				if(o.get_overlord_as_subject().get_ruler() == n)
@@ -1156,9 +1386,8 @@ bool can_start_colony(sys::state& state, dcon::nation_id n, dcon::state_definiti
 	bool adjacent = [&]() {
 		for(auto p : state.world.state_definition_get_abstract_state_membership(d)) {
 			if(!p.get_province().get_nation_from_province_ownership()) {
-				for(auto adj : p.get_province().get_province_adjacency()) {
-					auto indx = adj.get_connected_provinces(0) != p.get_province() ? 0 : 1;
-					auto o = adj.get_connected_provinces(indx).get_nation_from_province_ownership();
+				for(auto& nb : adjacent_provinces(state, p.get_province())) {
+					auto o = fatten(state.world, nb.province).get_nation_from_province_ownership();
 					if(o == n)
 						return true;
 					if(o.get_overlord_as_subject().get_ruler() == n)
@@ -1281,9 +1510,8 @@ bool fast_can_start_colony(sys::state& state, dcon::nation_id n, dcon::state_def
 	adjacent = [&]() {
 		for(auto p : state.world.state_definition_get_abstract_state_membership(d)) {
 			if(!p.get_province().get_nation_from_province_ownership()) {
-				for(auto adj : p.get_province().get_province_adjacency()) {
-					auto indx = adj.get_connected_provinces(0) != p.get_province() ? 0 : 1;
-					auto o = adj.get_connected_provinces(indx).get_nation_from_province_ownership();
+				for(auto& nb : adjacent_provinces(state, p.get_province())) {
+					auto o = fatten(state.world, nb.province).get_nation_from_province_ownership();
 					if(o == n)
 						return true;
 					if(o.get_overlord_as_subject().get_ruler() == n)
@@ -1544,6 +1772,7 @@ void set_rgo(sys::state& state, dcon::province_id prov, dcon::commodity_id c) {
 
 void enable_canal(sys::state& state, int32_t id) {
 	state.world.province_adjacency_get_type(state.province_definitions.canals[id]) &= ~province::border::impassible_bit;
+	update_adjacency_type(state, state.province_definitions.canals[id]);
 }
 
 // distance between to adjacent provinces
@@ -1664,6 +1893,41 @@ struct province_and_distance {
 	}
 };
 
+// The searches below can run on several threads at once, so each thread keeps its own province sized origins buffer and
+// reuses it instead of allocating and zeroing a new one per search. An entry only counts as set if its stamp matches the
+// current search, which makes starting a search a single increment.
+class path_origins {
+	std::vector<dcon::province_id> origins;
+	std::vector<uint32_t> stamps;
+	uint32_t current = 0;
+
+public:
+	void start(uint32_t size) {
+		if(origins.size() < size) {
+			origins.resize(size);
+			stamps.resize(size, 0);
+		}
+		++current;
+		if(current == 0) { // the stamp wrapped around; old entries could look current again
+			std::fill(stamps.begin(), stamps.end(), 0);
+			current = 1;
+		}
+	}
+	dcon::province_id get(dcon::province_id p) const {
+		return stamps[p.index()] == current ? origins[p.index()] : dcon::province_id{};
+	}
+	void set(dcon::province_id p, dcon::province_id v) {
+		origins[p.index()] = v;
+		stamps[p.index()] = current;
+	}
+};
+
+static path_origins& start_path_search(sys::state& state) {
+	thread_local path_origins scratch;
+	scratch.start(state.world.province_size());
+	return scratch;
+}
+
 static void assert_path_result(std::vector<dcon::province_id>& v) {
 	for(auto const e : v)
 		assert(bool(e));
@@ -1673,7 +1937,7 @@ static void assert_path_result(std::vector<dcon::province_id>& v) {
 std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a) {
 
 	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	std::vector<dcon::province_id> path_result;
 
@@ -1694,11 +1958,10 @@ std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_
 		auto nearest = path_heap.back();
 		path_heap.pop_back();
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-					adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov)) {
 				if(other_prov == end) {
@@ -1709,9 +1972,7 @@ std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_
 
 				if(other_prov.id.index() < state.province_definitions.first_sea_province.index()) { // is land
 					if(has_access_to_province(state, nation_as, other_prov)) {
-						/* This will work fine for most instances, except, possibly, for allied nations or enemy ones */
-						auto armies = state.world.province_get_army_location(other_prov);
-						float danger_factor = (armies.begin() == armies.end() || (*armies.begin()).get_army().get_controller_from_army_control() == nation_as) ? 1.f : 4.f;
+						float danger_factor = military::has_hostile_army_in_province(state, other_prov, nation_as) ? 4.f : 1.f;
 						path_heap.push_back(
 								province_and_distance{nearest.distance_covered + distance * danger_factor, direct_distance(state, other_prov, end) * danger_factor, other_prov});
 						std::push_heap(path_heap.begin(), path_heap.end());
@@ -1740,7 +2001,7 @@ std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_
 std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as) {
 
 	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	std::vector<dcon::province_id> path_result;
 
@@ -1761,11 +2022,10 @@ std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::prov
 		auto nearest = path_heap.back();
 		path_heap.pop_back();
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-				adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov)) {
 				if(other_prov == end) {
@@ -1797,7 +2057,7 @@ std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::prov
 // used for rebel unit and black-flagged unit pathfinding
 std::vector<dcon::province_id> make_unowned_land_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
 	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	std::vector<dcon::province_id> path_result;
 
@@ -1818,11 +2078,10 @@ std::vector<dcon::province_id> make_unowned_land_path(sys::state& state, dcon::p
 		auto nearest = path_heap.back();
 		path_heap.pop_back();
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-					adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov)) {
 				if(other_prov == end) {
@@ -1848,7 +2107,7 @@ std::vector<dcon::province_id> make_unowned_land_path(sys::state& state, dcon::p
 std::vector<dcon::province_id> make_naval_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
 
 	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	std::vector<dcon::province_id> path_result;
 
@@ -1869,11 +2128,10 @@ std::vector<dcon::province_id> make_naval_path(sys::state& state, dcon::province
 		auto nearest = path_heap.back();
 		path_heap.pop_back();
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-					adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			// can't move over impassible connections; can't move directly from port to port
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov) &&
@@ -1932,7 +2190,7 @@ struct retreat_province_and_distance {
 std::vector<dcon::province_id> make_naval_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
 
 	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	std::vector<dcon::province_id> path_result;
 
@@ -1955,11 +2213,10 @@ std::vector<dcon::province_id> make_naval_retreat_path(sys::state& state, dcon::
 			return path_result;
 		}
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-					adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov)) {
 				if((bits & province::border::coastal_bit) == 0) { // doesn't cross coast -- i.e. is sea province
@@ -1986,7 +2243,7 @@ std::vector<dcon::province_id> make_naval_retreat_path(sys::state& state, dcon::
 std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
 
 	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	origins_vector.set(start, dcon::province_id{0});
 
@@ -2011,11 +2268,10 @@ std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::n
 			return path_result;
 		}
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-					adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov)) {
 				if((bits & province::border::coastal_bit) == 0) { // doesn't cross coast -- i.e. is land province
@@ -2035,7 +2291,7 @@ std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::n
 
 std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
 	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	origins_vector.set(start, dcon::province_id{0});
 
@@ -2060,11 +2316,10 @@ std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dco
 			return path_result;
 		}
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-				adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov)) {
 				if((bits & province::border::coastal_bit) == 0) { // doesn't cross coast -- i.e. is land province
@@ -2087,7 +2342,7 @@ std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dco
 }
 std::vector<dcon::province_id> make_unowned_path_to_nearest_coast(sys::state& state, dcon::province_id start) {
 	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& origins_vector = start_path_search(state);
 
 	origins_vector.set(start, dcon::province_id{0});
 
@@ -2112,11 +2367,10 @@ std::vector<dcon::province_id> make_unowned_path_to_nearest_coast(sys::state& st
 			return path_result;
 		}
 
-		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
-			auto other_prov =
-				adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
-			auto bits = adj.get_type();
-			auto distance = adj.get_distance();
+		for(auto& nb : adjacent_provinces(state, nearest.province)) {
+			auto other_prov = fatten(state.world, nb.province);
+			auto bits = nb.type;
+			auto distance = nb.distance;
 
 			if((bits & province::border::impassible_bit) == 0 && !origins_vector.get(other_prov)) {
 				if((bits & province::border::coastal_bit) == 0) { // doesn't cross coast -- i.e. is land province
@@ -2155,6 +2409,42 @@ void restore_distances(sys::state& state) {
 		auto dist = direct_distance(state, adj.get_connected_provinces(0), adj.get_connected_provinces(1));
 		adj.set_distance(dist);
 	}
+
+	auto& offsets = state.province_definitions.neighbor_offsets;
+	auto& neighbors = state.province_definitions.neighbors;
+	offsets.clear();
+	neighbors.clear();
+	offsets.reserve(state.world.province_size() + 1);
+	neighbors.reserve(state.world.province_adjacency_size() * 2);
+	for(auto p : state.world.in_province) {
+		offsets.push_back(uint32_t(neighbors.size()));
+		for(auto adj : p.get_province_adjacency()) {
+			auto other = adj.get_connected_provinces(0) == p ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
+			neighbors.push_back(province_neighbor{ other.id, adj.get_type(), adj.get_distance(), adj.id });
+		}
+	}
+	offsets.push_back(uint32_t(neighbors.size()));
+}
+
+std::span<province_neighbor const> adjacent_provinces(sys::state const& state, dcon::province_id p) {
+	auto& offsets = state.province_definitions.neighbor_offsets;
+	assert(size_t(p.index()) + 1 < offsets.size());
+	return std::span<province_neighbor const>(state.province_definitions.neighbors.data() + offsets[p.index()], offsets[p.index() + 1] - offsets[p.index()]);
+}
+
+void update_adjacency_type(sys::state& state, dcon::province_adjacency_id adj) {
+	auto& offsets = state.province_definitions.neighbor_offsets;
+	auto& neighbors = state.province_definitions.neighbors;
+	if(offsets.empty())
+		return; // graph not built yet
+	auto t = state.world.province_adjacency_get_type(adj);
+	for(int32_t k = 0; k < 2; ++k) {
+		auto p = state.world.province_adjacency_get_connected_provinces(adj, k);
+		for(auto i = offsets[p.index()]; i < offsets[p.index() + 1]; ++i) {
+			if(neighbors[i].adjacency == adj)
+				neighbors[i].type = t;
+		}
+	}
 }
 
 } // namespace province
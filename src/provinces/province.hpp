@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include "dcon_generated.hpp"
 #include "constants.hpp"
 
@@ -17,12 +18,28 @@ inline constexpr dcon::province_id from_map_id(uint16_t id) {
 		return dcon::province_id(id - 1);
 }
 
+struct province_neighbor {
+	dcon::province_id province;
+	uint8_t type = 0; // province::border bits of the adjacency
+	float distance = 0.0f;
+	dcon::province_adjacency_id adjacency;
+};
+
 struct global_provincial_state {
 	std::vector<dcon::province_adjacency_id> canals;
 	std::vector<dcon::province_id> canal_provinces;
 	ankerl::unordered_dense::map<dcon::modifier_id, dcon::gfx_object_id, sys::modifier_hash> terrain_to_gfx_map;
 	std::vector<bool> connected_region_is_coastal;
 
+	// packed copy of the province_adjacency graph (not saved): the neighbors of province p are
+	// neighbors[neighbor_offsets[p] .. neighbor_offsets[p + 1]), in the same order as province_get_province_adjacency(p)
+	std::vector<uint32_t> neighbor_offsets;
+	std::vector<province_neighbor> neighbors;
+
+	// ownership changes not yet reflected in the connected regions / nation adjacency (not saved)
+	std::vector<dcon::province_id> pending_owner_changes;
+	bool pending_unowned_change = false; // one of the pending changes gave or took a province from no owner
+
 	dcon::province_id first_sea_province;
 	dcon::modifier_id europe;
 	dcon::modifier_id asia;
@@ -37,7 +54,10 @@ void update_connected_regions(sys::state& state);
 void update_cached_values(sys::state& state);
 void update_blockaded_cache(sys::state& state);
 void restore_unsaved_values(sys::state& state);
-void restore_distances(sys::state& state);
+void restore_distances(sys::state& state); // also rebuilds the packed adjacency graph
+
+std::span<province_neighbor const> adjacent_provinces(sys::state const& state, dcon::province_id p);
+void update_adjacency_type(sys::state& state, dcon::province_adjacency_id adj); // call after changing the type of an adjacency
 
 bool is_overseas(sys::state const& state, dcon::province_id ids);
 bool can_integrate_colony(sys::state& state, dcon::state_instance_id id);
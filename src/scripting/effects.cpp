@@ -28,6 +28,135 @@ inline uint32_t apply_subeffects(EFFECT_PARAMTERS) {
 	return i;
 }
 
+/*
+Batched execution of every_x scopes: when all the effects inside of a scope only modify the object they are applied to and
+consume no random numbers, and the limit (if any) doesn't move to other scopes, applying the effects to one object can't
+change the outcome for another one. Such scopes are run as a vectorized limit evaluation followed by direct column updates
+instead of being interpreted one object at a time. Anything else goes through the scalar path as before.
+*/
+
+template<typename F>
+bool all_subeffects_are(uint16_t const* tval, F&& f) {
+	auto const source_size = 1 + get_effect_scope_payload_size(tval);
+	auto sub_units_start = tval + 2 + effect_scope_data_payload(tval[0]);
+	if(sub_units_start >= tval + source_size)
+		return false;
+	while(sub_units_start < tval + source_size) {
+		if((sub_units_start[0] & effect::code_mask) >= effect::first_scope_code || !f(uint16_t(sub_units_start[0] & effect::code_mask)))
+			return false;
+		sub_units_start += 1 + get_generic_effect_payload_size(sub_units_start);
+	}
+	return true;
+}
+
+bool limit_stays_in_scope(sys::state& ws, uint16_t const* tval) {
+	if((tval[0] & effect::scope_has_limit) == 0)
+		return true;
+	auto limit = trigger::payload(tval[2]).tr_id;
+	auto data = ws.trigger_data.data() + ws.trigger_data_indices[limit.index() + 1];
+	auto const end = data + 1 + get_trigger_payload_size(data);
+	while(data < end) {
+		auto const code = data[0] & trigger::code_mask;
+		if(code >= trigger::first_scope_code) {
+			if(code != trigger::generic_scope)
+				return false;
+			data += 2 + trigger_scope_data_payload(data[0]);
+		} else {
+			data += 1 + get_trigger_non_scope_payload_size(data);
+		}
+	}
+	return true;
+}
+
+bool is_batchable_pop_scope(sys::state& ws, uint16_t const* tval) {
+	return all_subeffects_are(tval, [](uint16_t code) {
+		return code == effect::militancy || code == effect::consciousness || code == effect::money || code == effect::literacy;
+	}) && limit_stays_in_scope(ws, tval);
+}
+
+bool is_batchable_nation_scope(sys::state& ws, uint16_t const* tval) {
+	return all_subeffects_are(tval, [](uint16_t code) { return code == effect::treasury; }) && limit_stays_in_scope(ws, tval);
+}
+
+void apply_batched_pop_effects(uint16_t const* tval, sys::state& ws, std::vector<dcon::pop_id> const& pops, int32_t this_slot,
+		int32_t from_slot) {
+	auto const has_limit = (tval[0] & effect::scope_has_limit) != 0;
+	auto const source_size = 1 + get_effect_scope_payload_size(tval);
+	auto const sub_units_begin = tval + 2 + effect_scope_data_payload(tval[0]);
+
+	for(uint32_t base = 0; base < uint32_t(pops.size()); base += ve::vector_size) {
+		auto const count = std::min(uint32_t(ve::vector_size), uint32_t(pops.size()) - base);
+		ve::tagged_vector<int32_t> group;
+		for(uint32_t j = 0; j < count; ++j)
+			group.set(j, trigger::to_generic(pops[base + j]));
+
+		int32_t passed = int32_t((uint32_t(1) << count) - 1);
+		if(has_limit)
+			passed &= ve::compress_mask(trigger::evaluate(ws, trigger::payload(tval[2]).tr_id, group, this_slot, from_slot)).v;
+		if(passed == 0)
+			continue;
+
+		for(auto sub = sub_units_begin; sub < tval + source_size; sub += 1 + get_generic_effect_payload_size(sub)) {
+			auto const amount = trigger::read_float_from_payload(sub + 1);
+			assert(std::isfinite(amount));
+			for(uint32_t j = 0; j < count; ++j) {
+				if((passed & (1 << j)) == 0)
+					continue;
+				auto p = pops[base + j];
+				switch(sub[0] & effect::code_mask) {
+				case effect::militancy:
+				{
+					auto& c = ws.world.pop_get_militancy(p);
+					c = std::clamp(c + amount, 0.0f, 10.0f);
+					break;
+				}
+				case effect::consciousness:
+				{
+					auto& c = ws.world.pop_get_consciousness(p);
+					c = std::clamp(c + amount, 0.0f, 10.0f);
+					break;
+				}
+				case effect::money:
+				{
+					auto& m = ws.world.pop_get_savings(p);
+					m = std::max(0.0f, m + amount);
+					break;
+				}
+				case effect::literacy:
+				{
+					auto& l = ws.world.pop_get_literacy(p);
+					l = std::clamp(l + amount, 0.0f, 1.0f);
+					break;
+				}
+				default:
+					assert(false);
+				}
+			}
+		}
+	}
+}
+
+void apply_batched_nation_effects(uint16_t const* tval, sys::state& ws, int32_t this_slot, int32_t from_slot) {
+	auto const has_limit = (tval[0] & effect::scope_has_limit) != 0;
+	auto const source_size = 1 + get_effect_scope_payload_size(tval);
+	auto const sub_units_begin = tval + 2 + effect_scope_data_payload(tval[0]);
+
+	ws.world.execute_serial_over_nation([&](auto ids) {
+		ve::mask_vector passed = ws.world.nation_get_owned_province_count(ids) != 0;
+		if(has_limit)
+			passed = passed && trigger::evaluate(ws, trigger::payload(tval[2]).tr_id, trigger::to_generic(ids), this_slot, from_slot);
+
+		for(auto sub = sub_units_begin; sub < tval + source_size; sub += 1 + get_generic_effect_payload_size(sub)) {
+			assert((sub[0] & effect::code_mask) == effect::treasury);
+			auto const amount = trigger::read_float_from_payload(sub + 1);
+			assert(std::isfinite(amount));
+			auto t = ws.world.nation_get_stockpiles(ids, economy::money);
+			auto nt = ve::select(ws.world.nation_get_is_player_controlled(ids), t + amount, ve::max(0.0f, t + amount));
+			ws.world.nation_set_stockpiles(ids, economy::money, ve::select(passed, nt, t));
+		}
+	});
+}
+
 uint32_t es_generic_scope(EFFECT_PARAMTERS) {
 	return apply_subeffects(tval, ws, primary_slot, this_slot, from_slot, r_hi, r_lo, els);
 }
@@ -182,6 +311,10 @@ uint32_t es_x_country_scope_nation(EFFECT_PARAMTERS) {
 		}
 		return 0;
 	} else {
+		if(is_batchable_nation_scope(ws, tval)) {
+			apply_batched_nation_effects(tval, ws, this_slot, from_slot);
+			return 0;
+		}
 		uint32_t i = 0;
 		if((tval[0] & effect::scope_has_limit) != 0) {
 			auto limit = trigger::payload(tval[2]).tr_id;
@@ -612,6 +745,16 @@ uint32_t es_x_pop_scope_nation(EFFECT_PARAMTERS) {
 		}
 		return 0;
 	} else {
+		if(is_batchable_pop_scope(ws, tval)) {
+			std::vector<dcon::pop_id> pops;
+			for(auto p : ws.world.nation_get_province_ownership(trigger::to_nation(primary_slot))) {
+				for(auto pop : p.get_province().get_pop_location()) {
+					pops.push_back(pop.get_pop().id);
+				}
+			}
+			apply_batched_pop_effects(tval, ws, pops, this_slot, from_slot);
+			return 0;
+		}
 		uint32_t i = 0;
 		if((tval[0] & effect::scope_has_limit) != 0) {
 			auto limit = trigger::payload(tval[2]).tr_id;
@@ -657,6 +800,16 @@ uint32_t es_x_pop_scope_state(EFFECT_PARAMTERS) {
 		}
 		return 0;
 	} else {
+		if(is_batchable_pop_scope(ws, tval)) {
+			std::vector<dcon::pop_id> pops;
+			province::for_each_province_in_state_instance(ws, trigger::to_state(primary_slot), [&](dcon::province_id p) {
+				for(auto pop : ws.world.province_get_pop_location(p)) {
+					pops.push_back(pop.get_pop().id);
+				}
+			});
+			apply_batched_pop_effects(tval, ws, pops, this_slot, from_slot);
+			return 0;
+		}
 		if((tval[0] & effect::scope_has_limit) != 0) {
 			auto limit = trigger::payload(tval[2]).tr_id;
 			uint32_t i = 0;
@@ -702,6 +855,14 @@ uint32_t es_x_pop_scope_province(EFFECT_PARAMTERS) {
 		}
 		return 0;
 	} else {
+		if(is_batchable_pop_scope(ws, tval)) {
+			std::vector<dcon::pop_id> pops;
+			for(auto pop : ws.world.province_get_pop_location(trigger::to_prov(primary_slot))) {
+				pops.push_back(pop.get_pop().id);
+			}
+			apply_batched_pop_effects(tval, ws, pops, this_slot, from_slot);
+			return 0;
+		}
 		if((tval[0] & effect::scope_has_limit) != 0) {
 			auto limit = trigger::payload(tval[2]).tr_id;
 			uint32_t i = 0;
@@ -5150,12 +5311,14 @@ void execute(sys::state& state, dcon::effect_key key, int32_t primary, int32_t t
 		uint32_t r_hi) {
 	bool els = false;
 	internal_execute_effect(state.effect_data.data() + state.effect_data_indices[key.index() + 1], state, primary, this_slot, from_slot, r_lo, r_hi, els);
+	trigger::invalidate_cached_results();
 }
 
 void execute(sys::state& state, uint16_t const* data, int32_t primary, int32_t this_slot, int32_t from_slot, uint32_t r_lo,
 		uint32_t r_hi) {
 	bool els = false;
 	internal_execute_effect(data, state, primary, this_slot, from_slot, r_lo, r_hi, els);
+	trigger::invalidate_cached_results();
 }
 
 } // namespace effect
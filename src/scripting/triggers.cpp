@@ -1,4 +1,6 @@
 #include "triggers.hpp"
+#include <algorithm>
+#include <mutex>
 #include "system_state.hpp"
 #include "demographics.hpp"
 #include "military_templates.hpp"
@@ -5779,7 +5781,7 @@ TRIGGER_FUNCTION(tf_invention_pop) {
 TRIGGER_FUNCTION(tf_test) {
 	auto sid = trigger::payload(tval[1]).str_id;
 	auto tid = ws.world.stored_trigger_get_function(sid);
-	auto test_result = test_trigger_generic<return_type>(ws.trigger_data.data() + ws.trigger_data_indices[tid.index() + 1], ws, primary_slot, this_slot, from_slot);
+	auto test_result = test_trigger_generic<return_type>(ws.trigger_evaluation_data.data() + ws.trigger_data_indices[tid.index() + 1], ws, primary_slot, this_slot, from_slot);
 	return compare_to_true(tval[0], test_result);
 }
 
@@ -5873,7 +5875,7 @@ float evaluate_multiplicative_modifier(sys::state& state, dcon::value_modifier_k
 	for(uint32_t i = 0; i < base.segments_count && product != 0; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
-			if(test_trigger_generic<bool>(state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary,
+			if(test_trigger_generic<bool>(state.trigger_evaluation_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary,
 						 this_slot, from_slot)) {
 				product *= seg.factor;
 			}
@@ -5888,7 +5890,7 @@ float evaluate_additive_modifier(sys::state& state, dcon::value_modifier_key mod
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
-			if(test_trigger_generic<bool>(state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary,
+			if(test_trigger_generic<bool>(state.trigger_evaluation_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary,
 						 this_slot, from_slot)) {
 				sum += seg.factor;
 			}
@@ -5905,7 +5907,7 @@ ve::fp_vector evaluate_multiplicative_modifier(sys::state& state, dcon::value_mo
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.trigger_evaluation_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			product = ve::select(res, product * seg.factor, product);
 		}
 	}
@@ -5919,7 +5921,7 @@ ve::fp_vector evaluate_additive_modifier(sys::state& state, dcon::value_modifier
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.trigger_evaluation_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			sum = ve::select(res, sum + seg.factor, sum);
 		}
 	}
@@ -5934,7 +5936,7 @@ ve::fp_vector evaluate_multiplicative_modifier(sys::state& state, dcon::value_mo
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.trigger_evaluation_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			product = ve::select(res, product * seg.factor, product);
 		}
 	}
@@ -5948,7 +5950,7 @@ ve::fp_vector evaluate_additive_modifier(sys::state& state, dcon::value_modifier
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.trigger_evaluation_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			sum = ve::select(res, sum + seg.factor, sum);
 		}
 	}
@@ -5956,16 +5958,77 @@ ve::fp_vector evaluate_additive_modifier(sys::state& state, dcon::value_modifier
 }
 
 bool evaluate(sys::state& state, dcon::trigger_key key, int32_t primary, int32_t this_slot, int32_t from_slot) {
-	return test_trigger_generic<bool>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state, primary,
+	return test_trigger_generic<bool>(state.trigger_evaluation_data.data() + state.trigger_data_indices[key.index() + 1], state, primary,
 			this_slot, from_slot);
 }
 bool evaluate(sys::state& state, uint16_t const* data, int32_t primary, int32_t this_slot, int32_t from_slot) {
 	return test_trigger_generic<bool>(data, state, primary, this_slot, from_slot);
 }
 
+namespace {
+struct cached_trigger_call {
+	dcon::trigger_key key;
+	int32_t primary = 0;
+	int32_t this_slot = 0;
+	int32_t from_slot = 0;
+
+	bool operator==(cached_trigger_call const& o) const noexcept {
+		return key == o.key && primary == o.primary && this_slot == o.this_slot && from_slot == o.from_slot;
+	}
+};
+struct cached_trigger_call_hash {
+	using is_avalanching = void;
+	uint64_t operator()(cached_trigger_call const& c) const noexcept {
+		auto a = (uint64_t(c.key.index()) << 32) | uint32_t(c.primary);
+		auto b = (uint64_t(uint32_t(c.this_slot)) << 32) | uint32_t(c.from_slot);
+		return ankerl::unordered_dense::hash<uint64_t>{}(a) ^ (ankerl::unordered_dense::hash<uint64_t>{}(b) * 0x9E3779B97F4A7C15ull);
+	}
+};
+struct trigger_result_cache {
+	std::mutex lock;
+	ankerl::unordered_dense::map<cached_trigger_call, bool, cached_trigger_call_hash> results;
+	uint32_t generation = 0;
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+};
+trigger_result_cache global_result_cache;
+std::atomic<uint32_t> result_cache_generation = 1;
+}
+
+bool evaluate_cached(sys::state& state, dcon::trigger_key key, int32_t primary, int32_t this_slot, int32_t from_slot) {
+	cached_trigger_call call{key, primary, this_slot, from_slot};
+	auto generation = result_cache_generation.load(std::memory_order::acquire);
+	{
+		std::lock_guard l{global_result_cache.lock};
+		if(global_result_cache.generation != generation) {
+			global_result_cache.results.clear();
+			global_result_cache.generation = generation;
+		} else if(auto it = global_result_cache.results.find(call); it != global_result_cache.results.end()) {
+			++global_result_cache.hits;
+			return it->second;
+		}
+		++global_result_cache.misses;
+	}
+	// evaluated outside of the lock; if the generation moved on meanwhile the result is simply thrown away next time
+	auto result = evaluate(state, key, primary, this_slot, from_slot);
+	{
+		std::lock_guard l{global_result_cache.lock};
+		if(global_result_cache.generation == generation)
+			global_result_cache.results.insert_or_assign(call, result);
+	}
+	return result;
+}
+void invalidate_cached_results() {
+	result_cache_generation.fetch_add(1, std::memory_order::acq_rel);
+}
+cache_statistics get_cache_statistics() {
+	std::lock_guard l{global_result_cache.lock};
+	return cache_statistics{global_result_cache.hits, global_result_cache.misses};
+}
+
 ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguous_tags<int32_t> primary,
 		ve::tagged_vector<int32_t> this_slot, int32_t from_slot) {
-	return test_trigger_generic<ve::mask_vector>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state,
+	return test_trigger_generic<ve::mask_vector>(state.trigger_evaluation_data.data() + state.trigger_data_indices[key.index() + 1], state,
 			primary, this_slot, from_slot);
 }
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous_tags<int32_t> primary,
@@ -5975,7 +6038,7 @@ ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous
 
 ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::tagged_vector<int32_t> primary,
 		ve::tagged_vector<int32_t> this_slot, int32_t from_slot) {
-	return test_trigger_generic<ve::mask_vector>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state,
+	return test_trigger_generic<ve::mask_vector>(state.trigger_evaluation_data.data() + state.trigger_data_indices[key.index() + 1], state,
 			primary, this_slot, from_slot);
 }
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::tagged_vector<int32_t> primary,
@@ -5985,7 +6048,7 @@ ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::tagged_vec
 
 ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguous_tags<int32_t> primary,
 		ve::contiguous_tags<int32_t> this_slot, int32_t from_slot) {
-	return test_trigger_generic<ve::mask_vector>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state,
+	return test_trigger_generic<ve::mask_vector>(state.trigger_evaluation_data.data() + state.trigger_data_indices[key.index() + 1], state,
 			primary, this_slot, from_slot);
 }
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous_tags<int32_t> primary,
@@ -5993,4 +6056,94 @@ ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous
 	return test_trigger_generic<ve::mask_vector>(data, state, primary, this_slot, from_slot);
 }
 
+ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguous_tags<int32_t> primary, int32_t this_slot,
+		int32_t from_slot) {
+	return test_trigger_generic<ve::mask_vector>(state.trigger_evaluation_data.data() + state.trigger_data_indices[key.index() + 1], state,
+			primary, this_slot, from_slot);
+}
+ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::tagged_vector<int32_t> primary, int32_t this_slot,
+		int32_t from_slot) {
+	return test_trigger_generic<ve::mask_vector>(state.trigger_evaluation_data.data() + state.trigger_data_indices[key.index() + 1], state,
+			primary, this_slot, from_slot);
+}
+
+// rough number of entities a scope runs its members over
+float scope_fan_out(uint16_t code) {
+	switch(code & trigger::code_mask) {
+	case trigger::x_pop_scope_province:
+	case trigger::x_pop_scope_state:
+	case trigger::x_pop_scope_nation:
+	case trigger::x_country_scope:
+		return 64.0f;
+	case trigger::x_owned_province_scope_nation:
+	case trigger::x_core_scope_nation:
+	case trigger::x_state_scope:
+	case trigger::x_provinces_in_variable_region:
+	case trigger::x_provinces_in_variable_region_proper:
+		return 16.0f;
+	case trigger::x_neighbor_province_scope:
+	case trigger::x_neighbor_country_scope_nation:
+	case trigger::x_neighbor_country_scope_pop:
+	case trigger::x_war_countries_scope_nation:
+	case trigger::x_war_countries_scope_pop:
+	case trigger::x_greater_power_scope:
+	case trigger::x_owned_province_scope_state:
+	case trigger::x_core_scope_province:
+	case trigger::x_substate_scope:
+	case trigger::x_sphere_member_scope:
+	case trigger::x_neighbor_province_scope_state:
+		return 8.0f;
+	default:
+		return 1.0f;
+	}
+}
+
+float estimate_cost(uint16_t const* source) {
+	if((source[0] & trigger::code_mask) < trigger::first_scope_code)
+		return 1.0f;
+
+	float members_cost = 0.0f;
+	auto const source_size = 1 + trigger::get_trigger_scope_payload_size(source);
+	auto sub_units_start = source + 2 + trigger::trigger_scope_data_payload(source[0]);
+	while(sub_units_start < source + source_size) {
+		members_cost += estimate_cost(sub_units_start);
+		sub_units_start += 1 + trigger::get_trigger_payload_size(sub_units_start);
+	}
+	return 1.0f + members_cost * scope_fan_out(source[0]);
+}
+
+void order_members_by_cost(uint16_t* source) {
+	if((source[0] & trigger::code_mask) < trigger::first_scope_code)
+		return;
+
+	auto const source_size = 1 + trigger::get_trigger_scope_payload_size(source);
+	auto const first_member = source + 2 + trigger::trigger_scope_data_payload(source[0]);
+	for(auto sub = first_member; sub < source + source_size; sub += 1 + trigger::get_trigger_payload_size(sub)) {
+		order_members_by_cost(sub);
+	}
+
+	if(source[0] != trigger::generic_scope && source[0] != (trigger::generic_scope | trigger::is_disjunctive_scope))
+		return;
+
+	// evaluation stops at the first member that decides the scope for every slot, so test the cheap members first
+	struct member {
+		int32_t offset;
+		int32_t size;
+		float cost;
+	};
+	std::vector<member> members;
+	for(auto sub = first_member; sub < source + source_size; sub += 1 + trigger::get_trigger_payload_size(sub)) {
+		members.push_back(member{ int32_t(sub - source), 1 + trigger::get_trigger_payload_size(sub), estimate_cost(sub) });
+	}
+	if(members.size() > 1) {
+		std::stable_sort(members.begin(), members.end(), [](member const& a, member const& b) { return a.cost < b.cost; });
+		std::vector<uint16_t> reordered;
+		reordered.reserve(size_t(source + source_size - first_member));
+		for(auto& m : members) {
+			reordered.insert(reordered.end(), source + m.offset, source + m.offset + m.size);
+		}
+		std::copy(reordered.begin(), reordered.end(), first_member);
+	}
+}
+
 } // namespace trigger
@@ -177,9 +177,29 @@ ve::fp_vector evaluate_purely_additive_modifier(sys::state& state, dcon::value_m
 float evaluate_purely_additive_modifier(sys::state& state, dcon::value_modifier_key modifier, int32_t primary, int32_t this_slot, int32_t from_slot);
 ve::fp_vector evaluate_purely_additive_modifier(sys::state& state, dcon::value_modifier_key modifier, ve::contiguous_tags<int32_t> primary, ve::contiguous_tags<int32_t> this_slot, int32_t from_slot);
 
+/*
+state.trigger_data keeps every trigger as authored, which is what the tooltips display. The evaluate functions taking a key
+read state.trigger_evaluation_data instead: the same triggers at the same offsets, but with the members of each and/or
+scope ordered by estimated cost (order_members_by_cost), so that the short-circuiting evaluator tests the cheap members
+before the scopes that iterate over pops, provinces or countries.
+*/
+float estimate_cost(uint16_t const* source); // rough cost of one evaluation
+void order_members_by_cost(uint16_t* source); // reorders in place, the size is unchanged
+
 bool evaluate(sys::state& state, dcon::trigger_key key, int32_t primary, int32_t this_slot, int32_t from_slot);
 bool evaluate(sys::state& state, uint16_t const* data, int32_t primary, int32_t this_slot, int32_t from_slot);
 
+// Memoizing version of the scalar evaluate, for ui code that asks the same questions many times per frame (the decision
+// window sorts by allow, the topbar alert rechecks every decision, ...). Cached results are dropped by
+// invalidate_cached_results, which is called whenever effects run, commands execute, or a tick starts or ends.
+bool evaluate_cached(sys::state& state, dcon::trigger_key key, int32_t primary, int32_t this_slot, int32_t from_slot);
+void invalidate_cached_results();
+struct cache_statistics {
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+};
+cache_statistics get_cache_statistics();
+
 ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguous_tags<int32_t> primary,
 		ve::tagged_vector<int32_t> this_slot, int32_t from_slot);
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous_tags<int32_t> primary,
@@ -192,4 +212,8 @@ ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguou
 		ve::contiguous_tags<int32_t> this_slot, int32_t from_slot);
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous_tags<int32_t> primary,
 		ve::contiguous_tags<int32_t> this_slot, int32_t from_slot);
+ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguous_tags<int32_t> primary, int32_t this_slot,
+		int32_t from_slot);
+ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::tagged_vector<int32_t> primary, int32_t this_slot,
+		int32_t from_slot);
 } // namespace trigger
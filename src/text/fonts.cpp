@@ -280,6 +280,9 @@ void dead_reckoning(float distance_map[dr_size * dr_size], bool const in_map[dr_
 
 void font_manager::change_locale(sys::state& state, dcon::locale_id l) {
 	current_locale = l;
+	for(auto& fnt : font_array) {
+		fnt.clear_shaping_cache(); // shaping depends on the locale's script, language and font features
+	}
 
 	uint32_t end_language = 0;
 	auto locale_name = state.world.locale_get_locale_name(l);
@@ -594,6 +597,15 @@ void font::remake_cache(sys::state& state, font_selection type, stored_glyphs& t
 		return;
 	}
 
+	std::u16string cache_key;
+	cache_key.reserve(source.size() + 1);
+	cache_key.push_back(char16_t(type));
+	cache_key.append(reinterpret_cast<char16_t const*>(source.data()), source.size());
+	if(auto it = shaping_cache.find(cache_key); it != shaping_cache.end()) {
+		txt.glyph_info = it->second;
+		return;
+	}
+
 	auto locale = state.font_collection.get_current_locale();
 	UBiDi* para;
 	UErrorCode errorCode = U_ZERO_ERROR;
@@ -654,6 +666,10 @@ void font::remake_cache(sys::state& state, font_selection type, stored_glyphs& t
 	}
 
 	ubidi_close(para);
+
+	if(shaping_cache.size() >= shaping_cache_limit)
+		shaping_cache.clear();
+	shaping_cache.insert_or_assign(std::move(cache_key), txt.glyph_info);
 }
 
 void font::remake_bidiless_cache(sys::state& state, font_selection type, stored_glyphs& txt, std::span<uint16_t> source) {
@@ -671,6 +687,15 @@ void font::remake_bidiless_cache(sys::state& state, font_selection type, stored_
 		return;
 	}
 
+	std::u16string cache_key;
+	cache_key.reserve(source.size() + 1);
+	cache_key.push_back(char16_t(uint16_t(type) | 0x8000));
+	cache_key.append(reinterpret_cast<char16_t const*>(source.data()), source.size());
+	if(auto it = shaping_cache.find(cache_key); it != shaping_cache.end()) {
+		txt.glyph_info = it->second;
+		return;
+	}
+
 	auto locale = state.font_collection.get_current_locale();
 	
 	hb_feature_t feature_buffer[10];
@@ -707,6 +732,10 @@ void font::remake_bidiless_cache(sys::state& state, font_selection type, stored_
 	if(state.world.locale_get_native_rtl(locale)) {
 		std::reverse(txt.glyph_info.begin(), txt.glyph_info.end());
 	}
+
+	if(shaping_cache.size() >= shaping_cache_limit)
+		shaping_cache.clear();
+	shaping_cache.insert_or_assign(std::move(cache_key), txt.glyph_info);
 }
 
 void font::remake_cache(stored_glyphs& txt, std::string const& s) {
@@ -885,6 +914,7 @@ float font::text_extent(sys::state& state, stored_glyphs const& txt, uint32_t st
 void font_manager::set_classic_fonts(bool v) {
 	for(auto& fnt : font_array) {
 		fnt.only_raw_codepoints = v;
+		fnt.clear_shaping_cache();
 	}
 }
 
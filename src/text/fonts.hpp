@@ -6,6 +6,7 @@
 #include "hb.h"
 #include "bmfont.hpp"
 #include <span>
+#include <string>
 
 namespace sys {
 struct state;
@@ -122,6 +123,11 @@ public:
 	std::unique_ptr<FT_Byte[]> file_data;
 	bool only_raw_codepoints = false;
 
+	// shaped glyphs for recently shaped text, so that regenerating the same tooltip or row skips ICU and HarfBuzz.
+	// Keyed by the source text, prefixed with the font selection and whether bidi runs were resolved
+	ankerl::unordered_dense::map<std::u16string, std::vector<stored_glyph>> shaping_cache;
+	static constexpr size_t shaping_cache_limit = 8192;
+
 	~font();
 	bool can_display(char32_t ch_in) const;
 	void make_glyph(char32_t ch_in);
@@ -135,10 +141,13 @@ public:
 	void remake_cache(stored_glyphs& txt, std::string const& source);
 	void remake_cache(sys::state& state, font_selection type, stored_glyphs& txt, std::span<uint16_t> source);
 	void remake_bidiless_cache(sys::state& state, font_selection type, stored_glyphs& txt, std::span<uint16_t> source);
+	void clear_shaping_cache() {
+		shaping_cache.clear();
+	}
 
 	friend class font_manager;
 
-	font(font&& o) noexcept : file_name(std::move(o.file_name)), textures(std::move(o.textures)), glyph_positions(std::move(o.glyph_positions)), file_data(std::move(o.file_data)), first_free_slot(o.first_free_slot), only_raw_codepoints(o.only_raw_codepoints) {
+	font(font&& o) noexcept : file_name(std::move(o.file_name)), textures(std::move(o.textures)), glyph_positions(std::move(o.glyph_positions)), file_data(std::move(o.file_data)), first_free_slot(o.first_free_slot), only_raw_codepoints(o.only_raw_codepoints), shaping_cache(std::move(o.shaping_cache)) {
 		font_face = o.font_face;
 		o.font_face = nullptr;
 		hb_font_face = o.hb_font_face;
@@ -167,6 +176,7 @@ public:
 		internal_top_adj = o.internal_top_adj;
 		first_free_slot = o.first_free_slot;
 		only_raw_codepoints = o.only_raw_codepoints;
+		shaping_cache = std::move(o.shaping_cache);
 	}
 };
 
@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <string_view>
+#include <cstring>
 #include "dcon_generated.hpp"
 #include "nations.hpp"
 #include "unordered_dense.h"
@@ -452,14 +453,7 @@ struct vector_backed_hash {
 		auto sv = [&]() {
 			if(!tag)
 				return std::string_view();
-			auto start_position = text_data.data() + tag.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + tag.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(tag.index()));
 		}();
 		return ankerl::unordered_dense::detail::wyhash::hash(sv.data(), sv.size());
 	}
@@ -478,14 +472,7 @@ struct vector_backed_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 		}();
 		return sv == r;
 	}
@@ -493,14 +480,7 @@ struct vector_backed_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 		}();
 		return sv == r;
 	}
@@ -508,14 +488,7 @@ struct vector_backed_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 		}();
 		return sv == r;
 	}
@@ -523,14 +496,7 @@ struct vector_backed_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 		}();
 		return sv == r;
 	}
@@ -649,6 +615,27 @@ inline bool lazy_ci_eq(std::string_view a, std::string_view b) {
 
 }
 
+// strings in the key and locale pools are stored as [uint32_t length][characters][0] and referred to by the offset
+// of their first character, so that finding their end doesn't need a scan; offset 0 is always the empty string
+inline std::string_view pooled_string_view(std::vector<char> const& text_data, uint32_t offset) {
+	if(offset == 0)
+		return std::string_view();
+	uint32_t length = 0;
+	std::memcpy(&length, text_data.data() + offset - sizeof(uint32_t), sizeof(uint32_t));
+	return std::string_view(text_data.data() + offset, length);
+}
+// appends a string to a pool in the above format, returning its offset
+inline uint32_t add_to_pool(std::vector<char>& text_data, std::string_view text) {
+	if(text.length() == 0)
+		return 0;
+	auto length = uint32_t(text.length());
+	auto start = text_data.size() + sizeof(uint32_t);
+	text_data.resize(start + length + 1, char(0));
+	std::memcpy(text_data.data() + start - sizeof(uint32_t), &length, sizeof(uint32_t));
+	std::copy_n(text.data(), length, text_data.data() + start);
+	return uint32_t(start);
+}
+
 struct vector_backed_ci_hash {
 	using is_avalanching = void;
 	using is_transparent = void;
@@ -664,14 +651,7 @@ struct vector_backed_ci_hash {
 		auto sv = [&]() {
 			if(!tag)
 				return std::string_view();
-			auto start_position = text_data.data() + tag.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + tag.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(tag.index()));
 			}();
 		return detail::ci_wyhash(sv.data(), sv.size());
 	}
@@ -690,14 +670,7 @@ struct vector_backed_ci_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 			}();
 			return detail::lazy_ci_eq(sv, r);
 	}
@@ -705,14 +678,7 @@ struct vector_backed_ci_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 			}();
 			return detail::lazy_ci_eq(sv, r);
 	}
@@ -720,14 +686,7 @@ struct vector_backed_ci_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 			}();
 			return detail::lazy_ci_eq(sv, r);
 	}
@@ -735,14 +694,7 @@ struct vector_backed_ci_eq {
 		auto sv = [&]() {
 			if(!l)
 				return std::string_view();
-			auto start_position = text_data.data() + l.index();
-			auto data_size = text_data.size();
-			auto end_position = start_position;
-			for(; end_position < text_data.data() + data_size; ++end_position) {
-				if(*end_position == 0)
-					break;
-			}
-			return std::string_view(text_data.data() + l.index(), size_t(end_position - start_position));
+			return pooled_string_view(text_data, uint32_t(l.index()));
 			}();
 			return detail::lazy_ci_eq(sv, r);
 	}
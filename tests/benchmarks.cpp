@@ -0,0 +1,263 @@
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include "catch2/catch.hpp"
+#include "dcon_generated.hpp"
+#include "system_state.hpp"
+#include "serialization.hpp"
+#include "triggers.hpp"
+#include "demographics.hpp"
+#include "economy.hpp"
+#include "province.hpp"
+
+/*
+The benchmarks are hidden, so they don't run with the rest of the tests. Run them with
+
+	tests_project "[benchmarks]"
+
+(or build the run_benchmarks target). The results are written as json to the file named by ALICE_BENCHMARK_OUTPUT
+(benchmarks.json by default). If ALICE_BENCHMARK_BASELINE names the output of an earlier run, each benchmark is
+compared against it: a benchmark is reported as slower (or faster) only when the confidence intervals of the two
+means don't overlap.
+*/
+
+struct benchmark_result {
+	std::string name;
+	double mean = 0.0;
+	double mean_low = 0.0;
+	double mean_high = 0.0;
+	double std_dev = 0.0;
+	int32_t samples = 0;
+};
+
+// reads back the format written by benchmark_json_listener: one benchmark object per line
+std::map<std::string, benchmark_result> read_benchmark_baseline(char const* file_name) {
+	std::map<std::string, benchmark_result> result;
+	std::ifstream in(file_name);
+	std::string line;
+	auto read_number = [&](char const* key) {
+		auto pos = line.find(key);
+		return pos != std::string::npos ? std::strtod(line.c_str() + pos + std::strlen(key), nullptr) : 0.0;
+	};
+	while(std::getline(in, line)) {
+		auto name_start = line.find("{\"name\": \"");
+		if(name_start == std::string::npos)
+			continue;
+		name_start += std::strlen("{\"name\": \"");
+		auto name_end = line.find("\", ", name_start);
+		if(name_end == std::string::npos)
+			continue;
+		benchmark_result r;
+		r.name = line.substr(name_start, name_end - name_start);
+		r.mean = read_number("\"mean_ns\": ");
+		r.mean_low = read_number("\"mean_low_ns\": ");
+		r.mean_high = read_number("\"mean_high_ns\": ");
+		r.std_dev = read_number("\"std_dev_ns\": ");
+		r.samples = int32_t(read_number("\"samples\": "));
+		result.insert_or_assign(r.name, r);
+	}
+	return result;
+}
+
+std::string escape_benchmark_name(std::string const& name) {
+	std::string result;
+	for(auto c : name) {
+		if(c == '"' || c == '\\')
+			result += '\\';
+		result += c;
+	}
+	return result;
+}
+
+struct benchmark_json_listener : Catch::TestEventListenerBase {
+	using TestEventListenerBase::TestEventListenerBase;
+
+	std::vector<benchmark_result> results;
+
+	void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override {
+		benchmark_result r;
+		r.name = stats.info.name;
+		r.mean = stats.mean.point.count();
+		r.mean_low = stats.mean.lower_bound.count();
+		r.mean_high = stats.mean.upper_bound.count();
+		r.std_dev = stats.standardDeviation.point.count();
+		r.samples = int32_t(stats.info.samples);
+		results.push_back(r);
+	}
+
+	void testRunEnded(Catch::TestRunStats const& stats) override {
+		TestEventListenerBase::testRunEnded(stats);
+		if(results.empty())
+			return;
+
+		auto const output_name = std::getenv("ALICE_BENCHMARK_OUTPUT");
+		auto const baseline_name = std::getenv("ALICE_BENCHMARK_BASELINE");
+		auto const baseline = baseline_name ? read_benchmark_baseline(baseline_name) : std::map<std::string, benchmark_result>{};
+
+		std::ofstream out(output_name ? output_name : "benchmarks.json");
+		out << "{\"benchmarks\": [\n";
+		for(size_t i = 0; i < results.size(); ++i) {
+			auto const& r = results[i];
+			out << "{\"name\": \"" << escape_benchmark_name(r.name) << "\", \"mean_ns\": " << r.mean << ", \"mean_low_ns\": " << r.mean_low
+					<< ", \"mean_high_ns\": " << r.mean_high << ", \"std_dev_ns\": " << r.std_dev << ", \"samples\": " << r.samples;
+			if(auto it = baseline.find(escape_benchmark_name(r.name)); it != baseline.end()) {
+				auto const& b = it->second;
+				char const* verdict = "unchanged";
+				if(r.mean_low > b.mean_high)
+					verdict = "slower";
+				else if(r.mean_high < b.mean_low)
+					verdict = "faster";
+				out << ", \"baseline_mean_ns\": " << b.mean << ", \"change\": " << (b.mean > 0.0 ? r.mean / b.mean - 1.0 : 0.0) << ", \"verdict\": \"" << verdict << "\"";
+				if(verdict[0] == 's')
+					stream << "benchmark regression: " << r.name << " " << b.mean << "ns -> " << r.mean << "ns\n";
+			}
+			out << (i + 1 < results.size() ? "},\n" : "}\n");
+		}
+		out << "]}\n";
+	}
+};
+CATCH_REGISTER_LISTENER(benchmark_json_listener)
+
+TEST_CASE("trigger evaluation", "[.][benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto& state = *ws;
+
+	auto evaluate_for_all_nations = [&](dcon::trigger_key t) {
+		int32_t count = 0;
+		ve::execute_serial_fast<dcon::nation_id>(state.world.nation_size(), [&](auto ids) {
+			auto result = trigger::evaluate(state, t, trigger::to_generic(ids), trigger::to_generic(ids), 0);
+			count += int32_t(ve::compress_mask(result).v != 0);
+		});
+		return count;
+	};
+
+	auto const non_scope = state.commit_trigger_data(std::vector<uint16_t>{
+		uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_vassal) });
+	auto const any_owned_province = state.commit_trigger_data(std::vector<uint16_t>{
+		uint16_t(trigger::x_owned_province_scope_nation | trigger::is_existence_scope), uint16_t(2),
+		uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_coastal_province) });
+	auto const every_pop = state.commit_trigger_data(std::vector<uint16_t>{
+		uint16_t(trigger::x_pop_scope_nation), uint16_t(2),
+		uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_primary_culture_pop) });
+
+	BENCHMARK("trigger: non scope") {
+		return evaluate_for_all_nations(non_scope);
+	};
+	BENCHMARK("trigger: any owned province") {
+		return evaluate_for_all_nations(any_owned_province);
+	};
+	BENCHMARK("trigger: every pop") {
+		return evaluate_for_all_nations(every_pop);
+	};
+	BENCHMARK("trigger: decision potentials") {
+		int32_t count = 0;
+		for(auto d : state.world.in_decision) {
+			if(auto t = d.get_potential(); t)
+				count += evaluate_for_all_nations(t);
+		}
+		return count;
+	};
+	BENCHMARK("trigger: national event triggers") {
+		int32_t count = 0;
+		for(auto e : state.world.in_free_national_event) {
+			if(auto t = e.get_trigger(); t)
+				count += evaluate_for_all_nations(t);
+		}
+		return count;
+	};
+}
+
+// The stages below change the state they run on, so every sample starts from a snapshot of the loaded scenario. Restoring
+// it happens outside of the measured part; when catch times several runs in one sample, the later runs of that sample
+// start from the state the earlier ones left behind.
+struct state_snapshot {
+	std::unique_ptr<uint8_t[]> buffer;
+	size_t size = 0;
+
+	explicit state_snapshot(sys::state& state) : size(sys::sizeof_save_section(state)) {
+		buffer = std::unique_ptr<uint8_t[]>(new uint8_t[size]);
+		sys::write_save_section(buffer.get(), state);
+	}
+	void restore(sys::state& state) const {
+		sys::read_save_section(buffer.get(), buffer.get() + size, state);
+		state.fill_unsaved_data();
+	}
+};
+
+TEST_CASE("simulation stages", "[.][benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto& state = *ws;
+	state.game_seed = 808080;
+	state_snapshot const snapshot(state);
+
+	BENCHMARK_ADVANCED("demographics::regenerate_from_pop_data_full")(Catch::Benchmark::Chronometer meter) {
+		snapshot.restore(state);
+		meter.measure([&] { demographics::regenerate_from_pop_data_full(state); });
+	};
+	BENCHMARK_ADVANCED("economy::daily_update")(Catch::Benchmark::Chronometer meter) {
+		snapshot.restore(state);
+		meter.measure([&] { economy::daily_update(state, false); });
+	};
+}
+
+TEST_CASE("path finding", "[.][benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto& state = *ws;
+
+	// the capitals of the first and last nations that own land make for a long path across the map
+	dcon::province_id land_start;
+	dcon::province_id land_end;
+	for(auto n : state.world.in_nation) {
+		if(n.get_owned_province_count() != 0 && n.get_capital()) {
+			if(!land_start)
+				land_start = n.get_capital();
+			land_end = n.get_capital();
+		}
+	}
+	auto const sea_start = state.province_definitions.first_sea_province;
+	auto const sea_end = dcon::province_id(dcon::province_id::value_base_t(state.world.province_size() - 1));
+
+	BENCHMARK("province::make_unowned_land_path") {
+		return province::make_unowned_land_path(state, land_start, land_end);
+	};
+	BENCHMARK("province::make_naval_path") {
+		return province::make_naval_path(state, sea_start, sea_end);
+	};
+}
+
+TEST_CASE("save and checksum", "[.][benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto& state = *ws;
+
+	auto const buffer_size = sys::sizeof_save_section(state);
+	auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[buffer_size]);
+	sys::write_save_section(buffer.get(), state);
+
+	BENCHMARK("sys::sizeof_save_section") {
+		return sys::sizeof_save_section(state);
+	};
+	BENCHMARK("sys::write_save_section") {
+		return sys::write_save_section(buffer.get(), state);
+	};
+	BENCHMARK("sys::read_save_section") {
+		return sys::read_save_section(buffer.get(), buffer.get() + buffer_size, state);
+	};
+	BENCHMARK("state::get_save_checksum") {
+		// forget the columns of the previous run, otherwise every segment hash after the first sample is reused
+		state.save_checksums->columns.clear();
+		return state.get_save_checksum();
+	};
+}
+
+TEST_CASE("whole ticks", "[.][benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto& state = *ws;
+	state.game_seed = 808080;
+	state_snapshot const snapshot(state);
+
+	BENCHMARK_ADVANCED("state::single_game_tick")(Catch::Benchmark::Chronometer meter) {
+		snapshot.restore(state);
+		meter.measure([&] { state.single_game_tick(); });
+	};
+}
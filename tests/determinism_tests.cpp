@@ -7,6 +7,10 @@
 #include "system_state.hpp"
 #include "serialization.hpp"
 #include "prng.hpp"
+#include "triggers.hpp"
+#ifdef PREFER_ONE_TBB
+#include "tbb/task_arena.h"
+#endif
 
 TEST_CASE("prng_simple", "[determinism]") {
 	std::unique_ptr<sys::state> game_state = std::make_unique<sys::state>(); // too big for the stack
@@ -26,6 +30,62 @@ TEST_CASE("prng_low_entropy", "[determinism]") {
 	REQUIRE(r1 == r2);
 }
 
+TEST_CASE("prng_streams", "[determinism]") {
+	std::unique_ptr<sys::state> game_state = std::make_unique<sys::state>(); // too big for the stack
+	game_state->game_seed = 64273;
+	game_state->current_date.value = 49963;
+	auto r1 = rng::get_random(*game_state, rng::stream::invention_discovery, 12, 3);
+	REQUIRE(r1 == rng::get_random(*game_state, rng::stream::invention_discovery, 12, 3));
+	REQUIRE(r1 != rng::get_random(*game_state, rng::stream::movement_joining, 12, 3));
+	REQUIRE(r1 != rng::get_random(*game_state, rng::stream::invention_discovery, 13, 3));
+	REQUIRE(r1 != rng::get_random(*game_state, rng::stream::invention_discovery, 12, 4));
+	// a key that used to be built by hand from the same values must not land on the same draw
+	REQUIRE(r1 != rng::get_random(*game_state, uint32_t(3) << 5 ^ uint32_t(12)));
+}
+
+// runs f with the task pool limited to thread_count threads
+template<typename F>
+void run_with_thread_count(int32_t thread_count, F&& f) {
+#ifdef PREFER_ONE_TBB
+	tbb::task_arena arena(thread_count);
+	arena.execute(f);
+#else
+	concurrency::CurrentScheduler::Create(concurrency::SchedulerPolicy(2, concurrency::MinConcurrency, 1, concurrency::MaxConcurrency, thread_count));
+	f();
+	concurrency::CurrentScheduler::Detach();
+#endif
+}
+
+TEST_CASE("prng_streams_any_thread_count", "[determinism]") {
+	// a month of ticks covers the stream draws: the ai war target search (which runs in a parallel_for), movement
+	// joining and the invention discovery on the 1st
+	auto run_month = [](int32_t thread_count) {
+		std::unique_ptr<sys::state> game_state = load_testing_scenario_file();
+		game_state->game_seed = 808080;
+		auto start = game_state->get_save_checksum();
+		run_with_thread_count(thread_count, [&]() {
+			for(int32_t i = 0; i < 32; ++i)
+				game_state->single_game_tick();
+		});
+		auto const end = game_state->get_save_checksum();
+		REQUIRE(!start.is_equal(end));
+		return end;
+	};
+
+	auto serial = run_month(1);
+	REQUIRE(serial.is_equal(run_month(2)));
+	REQUIRE(serial.is_equal(run_month(int32_t(std::max(4u, std::thread::hardware_concurrency())))));
+
+	std::unique_ptr<sys::state> game_state = std::make_unique<sys::state>(); // too big for the stack
+	game_state->game_seed = 1;
+	game_state->current_date.value = 1;
+	for(uint32_t i = 0; i < 16; ++i) {
+		auto v1 = rng::to_unit_float(rng::get_random(*game_state, rng::stream::ai_war_targets, i, 0));
+		REQUIRE(v1 >= 0.0f);
+		REQUIRE(v1 < 1.0f);
+	}
+}
+
 #define UNOPTIMIZABLE_FLOAT(name, value) \
 	char name##_storage[sizeof(float)]; \
 	new (&name##_storage) float(value); \
@@ -713,3 +773,441 @@ TEST_CASE("sim_year", "[determinism]") {
 		checked_single_tick(*game_state_1, *game_state_2);
 	}
 }
+
+// the per-slot land combat damage as it was computed before the frontage was gathered into rows
+void reference_land_combat_damage(sys::state& state, dcon::land_battle_id b, military::land_combat_modifiers const& mods) {
+	auto combat_width = state.world.land_battle_get_combat_width(b);
+	auto& att_back = state.world.land_battle_get_attacker_back_line(b);
+	auto& def_back = state.world.land_battle_get_defender_back_line(b);
+	auto& att_front = state.world.land_battle_get_attacker_front_line(b);
+	auto& def_front = state.world.land_battle_get_defender_front_line(b);
+
+	float attacker_casualties = 0;
+	float defender_casualties = 0;
+
+	auto hit = [&](dcon::regiment_id target, float str_damage, float org_damage, bool target_is_attacker) {
+		auto& cstr = state.world.regiment_get_strength(target);
+		str_damage = std::min(str_damage, cstr);
+		state.world.regiment_get_pending_damage(target) += str_damage;
+		cstr -= str_damage;
+		(target_is_attacker ? attacker_casualties : defender_casualties) += str_damage;
+
+		auto& org = state.world.regiment_get_org(target);
+		org = std::max(0.0f, org - org_damage);
+		switch(state.military_definitions.unit_base_definitions[state.world.regiment_get_type(target)].type) {
+		case military::unit_type::infantry:
+			(target_is_attacker ? state.world.land_battle_get_attacker_infantry_lost(b) : state.world.land_battle_get_defender_infantry_lost(b)) += str_damage;
+			break;
+		case military::unit_type::cavalry:
+			(target_is_attacker ? state.world.land_battle_get_attacker_cav_lost(b) : state.world.land_battle_get_defender_cav_lost(b)) += str_damage;
+			break;
+		case military::unit_type::support:
+		case military::unit_type::special:
+			(target_is_attacker ? state.world.land_battle_get_attacker_support_lost(b) : state.world.land_battle_get_defender_support_lost(b)) += str_damage;
+			break;
+		default:
+			break;
+		}
+	};
+	auto tactics = [&](dcon::nation_id n) {
+		return state.defines.base_military_tactics + state.world.nation_get_modifier_values(n, sys::national_mod_offsets::military_tactics);
+	};
+	auto org_resist = [&](dcon::nation_id n) {
+		return 1.0f + state.world.nation_get_modifier_values(n, sys::national_mod_offsets::land_organisation);
+	};
+
+	for(int32_t i = 0; i < combat_width; ++i) {
+		if(att_back[i] && def_front[i]) {
+			auto tech_att_nation = military::tech_nation_for_regiment(state, att_back[i]);
+			auto tech_def_nation = military::tech_nation_for_regiment(state, def_front[i]);
+			auto& att_stats = state.world.nation_get_unit_stats(tech_att_nation, state.world.regiment_get_type(att_back[i]));
+			auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(def_front[i]));
+
+			auto str_damage = military::str_dam_mul * (att_stats.attack_or_gun_power * 0.1f + 1.0f) * att_stats.support * mods.attacker_mod /
+				(mods.defender_fort * tactics(tech_def_nation));
+			auto org_damage = military::org_dam_mul * (att_stats.attack_or_gun_power * 0.1f + 1.0f) * att_stats.support * mods.attacker_mod /
+				(mods.defender_fort * mods.defender_org_bonus * def_stats.discipline_or_evasion * org_resist(tech_def_nation));
+			hit(def_front[i], str_damage, org_damage, false);
+		}
+		if(def_back[i] && att_front[i]) {
+			auto tech_def_nation = military::tech_nation_for_regiment(state, def_back[i]);
+			auto tech_att_nation = military::tech_nation_for_regiment(state, att_front[i]);
+			auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(def_back[i]));
+
+			auto str_damage = military::str_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * def_stats.support * mods.defender_mod / (tactics(tech_att_nation));
+			auto org_damage = military::org_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * def_stats.support * mods.defender_mod /
+				(mods.attacker_org_bonus * def_stats.discipline_or_evasion * org_resist(tech_att_nation));
+			hit(att_front[i], str_damage, org_damage, true);
+		}
+		if(att_front[i]) {
+			auto tech_att_nation = military::tech_nation_for_regiment(state, att_front[i]);
+			auto& att_stats = state.world.nation_get_unit_stats(tech_att_nation, state.world.regiment_get_type(att_front[i]));
+			auto target = def_front[i];
+			if(auto mv = state.military_definitions.unit_base_definitions[state.world.regiment_get_type(att_front[i])].maneuver; !target && mv > 0.0f) {
+				for(int32_t cnt = 1; i - cnt * 2 >= 0 && cnt <= int32_t(mv); ++cnt) {
+					if(def_front[i - cnt * 2]) {
+						target = def_front[i - cnt * 2];
+						break;
+					}
+				}
+			}
+			if(target) {
+				auto tech_def_nation = military::tech_nation_for_regiment(state, target);
+				auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(target));
+				auto str_damage = military::str_dam_mul * (att_stats.attack_or_gun_power * 0.1f + 1.0f) * mods.attacker_mod /
+					(mods.defender_fort * tactics(tech_def_nation));
+				auto org_damage = military::org_dam_mul * (att_stats.attack_or_gun_power * 0.1f + 1.0f) * mods.attacker_mod /
+					(mods.defender_fort * def_stats.discipline_or_evasion * mods.defender_org_bonus * org_resist(tech_def_nation));
+				hit(target, str_damage, org_damage, false);
+			}
+		}
+		if(def_front[i]) {
+			auto tech_def_nation = military::tech_nation_for_regiment(state, def_front[i]);
+			auto& def_stats = state.world.nation_get_unit_stats(tech_def_nation, state.world.regiment_get_type(def_front[i]));
+			auto target = att_front[i];
+			if(auto mv = state.military_definitions.unit_base_definitions[state.world.regiment_get_type(def_front[i])].maneuver; !target && mv > 0.0f) {
+				for(int32_t cnt = 1; i - cnt * 2 >= 0 && cnt <= int32_t(mv); ++cnt) {
+					if(att_front[i - cnt * 2]) {
+						target = att_front[i - cnt * 2];
+						break;
+					}
+				}
+			}
+			if(target) {
+				auto tech_att_nation = military::tech_nation_for_regiment(state, target);
+				auto str_damage = military::str_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * mods.defender_mod / (tactics(tech_att_nation));
+				auto org_damage = military::org_dam_mul * (def_stats.attack_or_gun_power * 0.1f + 1.0f) * mods.defender_mod /
+					(mods.attacker_org_bonus * def_stats.discipline_or_evasion * org_resist(tech_att_nation));
+				hit(target, str_damage, org_damage, true);
+			}
+		}
+	}
+
+	state.world.land_battle_set_attacker_casualties(b, attacker_casualties);
+	state.world.land_battle_set_defender_casualties(b, defender_casualties);
+}
+
+TEST_CASE("land_combat_matches_per_slot_damage", "[determinism]") {
+	std::unique_ptr<sys::state> game_state = load_testing_scenario_file();
+	auto& state = *game_state;
+
+	std::vector<dcon::regiment_id> regiments;
+	for(auto r : state.world.in_regiment) {
+		if(military::tech_nation_for_regiment(state, r))
+			regiments.push_back(r);
+	}
+	REQUIRE(regiments.size() >= 4 * 4 * 30);
+
+	// a fixed set of battles with partly filled lines, so that units also have to look sideways for targets
+	std::vector<dcon::land_battle_id> battles;
+	std::vector<military::land_combat_modifiers> mods;
+	size_t next = 0;
+	for(int32_t k = 0; k < 4; ++k) {
+		auto b = state.world.create_land_battle();
+		state.world.land_battle_set_combat_width(b, uint8_t(k == 0 ? 30 : 20 + 2 * k));
+		auto fill = [&](std::array<dcon::regiment_id, 30>& line, int32_t salt) {
+			for(int32_t i = 0; i < 30; ++i) {
+				if((i * 7 + k * 3 + salt) % 5 != 0) {
+					auto r = regiments[next++];
+					line[i] = r;
+					auto f = float((next * 37) % 100) / 100.0f;
+					state.world.regiment_set_strength(r, 0.02f + 0.98f * f);
+					state.world.regiment_set_org(r, 30.0f * (1.0f - f));
+					state.world.regiment_set_pending_damage(r, 0.0f);
+				} else {
+					line[i] = dcon::regiment_id{};
+				}
+			}
+		};
+		fill(state.world.land_battle_get_attacker_back_line(b), 0);
+		fill(state.world.land_battle_get_defender_back_line(b), 1);
+		fill(state.world.land_battle_get_attacker_front_line(b), 2);
+		fill(state.world.land_battle_get_defender_front_line(b), 3);
+		battles.push_back(b);
+		mods.push_back(military::land_combat_modifiers{ 1.0f + 0.25f * float(k), 1.5f - 0.25f * float(k), k == 2 ? 1.3f : 1.0f, 1.0f + 0.1f * float(k), 1.2f - 0.1f * float(k) });
+	}
+
+	struct regiment_values {
+		float strength;
+		float org;
+		float pending_damage;
+		bool operator==(regiment_values const& o) const {
+			return strength == o.strength && org == o.org && pending_damage == o.pending_damage;
+		}
+	};
+	struct battle_values {
+		float casualties[2];
+		float lost[6];
+		bool operator==(battle_values const& o) const {
+			return std::equal(casualties, casualties + 2, o.casualties) && std::equal(lost, lost + 6, o.lost);
+		}
+	};
+	auto used = std::vector<dcon::regiment_id>(regiments.begin(), regiments.begin() + next);
+	auto read_regiments = [&]() {
+		std::vector<regiment_values> v;
+		for(auto r : used)
+			v.push_back(regiment_values{ state.world.regiment_get_strength(r), state.world.regiment_get_org(r), state.world.regiment_get_pending_damage(r) });
+		return v;
+	};
+	auto write_regiments = [&](std::vector<regiment_values> const& v) {
+		for(size_t i = 0; i < used.size(); ++i) {
+			state.world.regiment_set_strength(used[i], v[i].strength);
+			state.world.regiment_set_org(used[i], v[i].org);
+			state.world.regiment_set_pending_damage(used[i], v[i].pending_damage);
+		}
+	};
+	auto read_battle = [&](dcon::land_battle_id b) {
+		return battle_values{ { state.world.land_battle_get_attacker_casualties(b), state.world.land_battle_get_defender_casualties(b) },
+			{ state.world.land_battle_get_attacker_infantry_lost(b), state.world.land_battle_get_attacker_cav_lost(b), state.world.land_battle_get_attacker_support_lost(b),
+				state.world.land_battle_get_defender_infantry_lost(b), state.world.land_battle_get_defender_cav_lost(b), state.world.land_battle_get_defender_support_lost(b) } };
+	};
+	auto write_battle = [&](dcon::land_battle_id b, battle_values const& v) {
+		state.world.land_battle_set_attacker_casualties(b, v.casualties[0]);
+		state.world.land_battle_set_defender_casualties(b, v.casualties[1]);
+		state.world.land_battle_set_attacker_infantry_lost(b, v.lost[0]);
+		state.world.land_battle_set_attacker_cav_lost(b, v.lost[1]);
+		state.world.land_battle_set_attacker_support_lost(b, v.lost[2]);
+		state.world.land_battle_set_defender_infantry_lost(b, v.lost[3]);
+		state.world.land_battle_set_defender_cav_lost(b, v.lost[4]);
+		state.world.land_battle_set_defender_support_lost(b, v.lost[5]);
+	};
+
+	// several rounds, so that later rounds start from damaged regiments
+	for(int32_t round = 0; round < 3; ++round) {
+		auto start_regiments = read_regiments();
+		std::vector<battle_values> start_battles;
+		for(auto b : battles)
+			start_battles.push_back(read_battle(b));
+
+		for(size_t k = 0; k < battles.size(); ++k)
+			reference_land_combat_damage(state, battles[k], mods[k]);
+		auto expected_regiments = read_regiments();
+		std::vector<battle_values> expected_battles;
+		for(auto b : battles)
+			expected_battles.push_back(read_battle(b));
+
+		write_regiments(start_regiments);
+		for(size_t k = 0; k < battles.size(); ++k)
+			write_battle(battles[k], start_battles[k]);
+
+		for(size_t k = 0; k < battles.size(); ++k)
+			military::apply_land_combat_damage(state, battles[k], mods[k]);
+
+		REQUIRE(read_regiments() == expected_regiments);
+		for(size_t k = 0; k < battles.size(); ++k)
+			REQUIRE(read_battle(battles[k]) == expected_battles[k]);
+
+		// the battle outcome follows from which regiments are left standing on each line
+		for(size_t i = 0; i < used.size(); ++i) {
+			REQUIRE((expected_regiments[i].strength <= 0.0f || expected_regiments[i].org < 0.1f) ==
+				(state.world.regiment_get_strength(used[i]) <= 0.0f || state.world.regiment_get_org(used[i]) < 0.1f));
+		}
+	}
+}
+
+// the per-province army index as rebuilt from scratch, with each province's entries in a fixed order
+std::vector<std::vector<std::pair<int32_t, int32_t>>> rebuilt_army_presence(sys::state& state) {
+	auto incremental = state.military_definitions.army_presence_by_province;
+	military::rebuild_army_location_index(state);
+	std::vector<std::vector<std::pair<int32_t, int32_t>>> result;
+	for(auto p : state.world.in_province) {
+		auto& rebuilt = state.military_definitions.army_presence_by_province[p];
+		std::vector<std::pair<int32_t, int32_t>> entries;
+		for(auto& e : rebuilt)
+			entries.emplace_back(e.controller.index(), int32_t(e.count));
+		std::sort(entries.begin(), entries.end());
+		result.push_back(std::move(entries));
+	}
+	state.military_definitions.army_presence_by_province = incremental;
+	return result;
+}
+std::vector<std::vector<std::pair<int32_t, int32_t>>> current_army_presence(sys::state& state) {
+	std::vector<std::vector<std::pair<int32_t, int32_t>>> result;
+	for(auto p : state.world.in_province) {
+		std::vector<std::pair<int32_t, int32_t>> entries;
+		for(auto& e : state.military_definitions.army_presence_by_province[p])
+			entries.emplace_back(e.controller.index(), int32_t(e.count));
+		std::sort(entries.begin(), entries.end());
+		result.push_back(std::move(entries));
+	}
+	return result;
+}
+
+TEST_CASE("army_location_index", "[determinism]") {
+	std::unique_ptr<sys::state> game_state = load_testing_scenario_file();
+	auto& state = *game_state;
+	REQUIRE(current_army_presence(state) == rebuilt_army_presence(state));
+
+	std::vector<dcon::army_id> land_armies;
+	for(auto a : state.world.in_army) {
+		if(a.get_controller_from_army_control() && !a.get_navy_from_army_transport()
+			&& a.get_location_from_army_location().id.index() < state.province_definitions.first_sea_province.index())
+			land_armies.push_back(a);
+	}
+	REQUIRE(land_armies.size() >= 16);
+
+	// moves: shuffle armies between the locations of other armies
+	for(size_t i = 0; i + 1 < 8; ++i) {
+		military::set_army_location(state, land_armies[i], state.world.army_get_location_from_army_location(land_armies[(i * 5 + 3) % land_armies.size()]));
+	}
+	REQUIRE(current_army_presence(state) == rebuilt_army_presence(state));
+
+	// a battle: declare war between the owners of two armies and march one onto the other, then resolve it
+	dcon::army_id attacker_army;
+	dcon::army_id defender_army;
+	for(size_t i = 8; i < land_armies.size() && !defender_army; ++i) {
+		for(size_t j = i + 1; j < land_armies.size(); ++j) {
+			auto an = state.world.army_get_controller_from_army_control(land_armies[i]);
+			auto dn = state.world.army_get_controller_from_army_control(land_armies[j]);
+			if(an != dn && !military::are_allied_in_war(state, an, dn) && !nations::are_allied(state, an, dn)
+				&& !state.world.nation_get_overlord_as_subject(an) && !state.world.nation_get_overlord_as_subject(dn)) {
+				attacker_army = land_armies[i];
+				defender_army = land_armies[j];
+				break;
+			}
+		}
+	}
+	REQUIRE(bool(attacker_army));
+	military::create_war(state, state.world.army_get_controller_from_army_control(attacker_army), state.world.army_get_controller_from_army_control(defender_army),
+		dcon::cb_type_id{}, dcon::state_definition_id{}, dcon::national_identity_id{}, dcon::nation_id{});
+	military::army_arrives_in_province(state, attacker_army, state.world.army_get_location_from_army_location(defender_army), military::crossing_type::none);
+	REQUIRE(current_army_presence(state) == rebuilt_army_presence(state));
+
+	auto battle = state.world.army_get_battle_from_army_battle_participation(attacker_army);
+	REQUIRE(bool(battle));
+	military::end_battle(state, battle, military::battle_result::attacker_won);
+	REQUIRE(current_army_presence(state) == rebuilt_army_presence(state));
+
+	// deletions
+	for(size_t i = 0; i < 4; ++i) {
+		auto a = land_armies[land_armies.size() - 1 - i];
+		if(state.world.army_is_valid(a) && !state.world.army_get_battle_from_army_battle_participation(a))
+			military::cleanup_army(state, a);
+	}
+	REQUIRE(current_army_presence(state) == rebuilt_army_presence(state));
+}
+
+// each nation's neighbors, in the order nation_get_nation_adjacency enumerates them
+std::vector<std::vector<dcon::nation_id>> nation_adjacency_lists(sys::state& state) {
+	std::vector<std::vector<dcon::nation_id>> result(state.world.nation_size());
+	for(auto n : state.world.in_nation) {
+		for(auto adj : n.get_nation_adjacency()) {
+			auto other = adj.get_connected_nations(0) == n ? adj.get_connected_nations(1) : adj.get_connected_nations(0);
+			result[n.id.index()].push_back(other.id);
+		}
+	}
+	return result;
+}
+
+TEST_CASE("incremental_nation_adjacency_order", "[determinism]") {
+	std::unique_ptr<sys::state> game_state = load_testing_scenario_file();
+	auto& state = *game_state;
+	state.adjacency_data_out_of_date = true;
+	province::update_connected_regions(state);
+
+	// hand a few border provinces over to the neighbor across the border
+	auto const land_count = state.province_definitions.first_sea_province.index();
+	int32_t changed = 0;
+	for(int32_t i = 0; i < land_count && changed < 6; i += 37) {
+		dcon::province_id p{ dcon::province_id::value_base_t(i) };
+		auto owner = state.world.province_get_nation_from_province_ownership(p);
+		if(!owner)
+			continue;
+		for(auto& nb : province::adjacent_provinces(state, p)) {
+			auto other = state.world.province_get_nation_from_province_ownership(nb.province);
+			if((nb.type & (province::border::coastal_bit | province::border::impassible_bit)) == 0 && other && other != owner) {
+				province::change_province_owner(state, p, other);
+				++changed;
+				break;
+			}
+		}
+	}
+	REQUIRE(changed > 0);
+
+	REQUIRE(province::update_connected_regions_incrementally(state));
+	state.province_definitions.pending_owner_changes.clear();
+	auto const incremental_adjacency = nation_adjacency_lists(state);
+	std::vector<uint16_t> incremental_regions(land_count);
+	for(int32_t i = 0; i < land_count; ++i)
+		incremental_regions[i] = state.world.province_get_connected_region_id(dcon::province_id{ dcon::province_id::value_base_t(i) });
+
+	province::rebuild_all_connected_regions(state);
+	auto const full_adjacency = nation_adjacency_lists(state);
+	for(uint32_t i = 0; i < full_adjacency.size(); ++i) {
+		REQUIRE(incremental_adjacency[i].size() == full_adjacency[i].size());
+		for(uint32_t j = 0; j < full_adjacency[i].size(); ++j)
+			REQUIRE(incremental_adjacency[i][j] == full_adjacency[i][j]);
+	}
+
+	// region ids are recycled differently, but both paths must produce the same partition
+	auto const region_bound = std::max(state.province_definitions.connected_region_is_coastal.size(), size_t(land_count)) + 1;
+	std::vector<uint16_t> full_of_incremental(region_bound, uint16_t(0));
+	std::vector<uint16_t> incremental_of_full(region_bound, uint16_t(0));
+	for(int32_t i = 0; i < land_count; ++i) {
+		auto full_id = state.world.province_get_connected_region_id(dcon::province_id{ dcon::province_id::value_base_t(i) });
+		if(full_of_incremental[incremental_regions[i]] == 0)
+			full_of_incremental[incremental_regions[i]] = full_id;
+		if(incremental_of_full[full_id] == 0)
+			incremental_of_full[full_id] = incremental_regions[i];
+		REQUIRE(full_of_incremental[incremental_regions[i]] == full_id);
+		REQUIRE(incremental_of_full[full_id] == incremental_regions[i]);
+	}
+
+	// a province left without an owner forces the full rebuild
+	for(int32_t i = 0; i < land_count; ++i) {
+		dcon::province_id p{ dcon::province_id::value_base_t(i) };
+		if(state.world.province_get_nation_from_province_ownership(p)) {
+			province::change_province_owner(state, p, dcon::nation_id{});
+			break;
+		}
+	}
+	REQUIRE(state.province_definitions.pending_unowned_change);
+	REQUIRE(!province::update_connected_regions_incrementally(state));
+	province::update_connected_regions(state);
+	REQUIRE(!state.province_definitions.pending_unowned_change);
+	REQUIRE(state.province_definitions.pending_owner_changes.empty());
+}
+
+void require_same_rebel_membership(sys::state& a, sys::state& b) {
+	REQUIRE(a.world.rebel_faction_size() == b.world.rebel_faction_size());
+	for(auto rf : a.world.in_rebel_faction) {
+		dcon::rebel_faction_id other{ rf.id };
+		REQUIRE(rf.get_type().id == b.world.rebel_faction_get_type(other));
+		REQUIRE(rf.get_defection_target().id == b.world.rebel_faction_get_defection_target(other));
+		REQUIRE(rf.get_possible_regiments() == b.world.rebel_faction_get_possible_regiments(other));
+		REQUIRE(rf.get_ruler_from_rebellion_within().id == b.world.rebel_faction_get_ruler_from_rebellion_within(other));
+	}
+	for(auto p : a.world.in_pop) {
+		REQUIRE(p.get_rebel_faction_from_pop_rebellion_membership().id == b.world.pop_get_rebel_faction_from_pop_rebellion_membership(p));
+	}
+}
+
+TEST_CASE("rebel_membership_early_out", "[determinism]") {
+	std::unique_ptr<sys::state> game_state_1 = load_testing_scenario_file();
+	std::unique_ptr<sys::state> game_state_2 = load_testing_scenario_file();
+	auto& ws = *game_state_1;
+	auto& reference = *game_state_2;
+	ws.game_seed = reference.game_seed = 808080;
+
+	// the reference runs every pop through the full update, as before the early out
+	auto run_reference = [&]() {
+		reference.world.for_each_pop([&](dcon::pop_id p) { rebel::update_single_pop_rebel_membership(reference, p); });
+	};
+	auto set_militancy = [&](uint32_t round) {
+		auto const threshold = ws.defines.mil_to_join_rebel;
+		for(auto p : ws.world.in_pop) {
+			auto h = (uint32_t(p.id.index()) * 2654435761u) ^ (round * 40503u);
+			float mil = (h % 7 < 2) ? threshold + float(h % 3) : std::max(0.0f, threshold - 1.0f - float(h % 2));
+			p.set_militancy(mil);
+			reference.world.pop_set_militancy(p, mil);
+		}
+	};
+
+	// pops join, some leave, some rejoin (possibly other factions) and some stay in the faction they have
+	for(uint32_t round = 0; round < 4; ++round) {
+		set_militancy(round);
+		rebel::update_pop_rebel_membership(ws);
+		run_reference();
+		require_same_rebel_membership(ws, reference);
+	}
+}
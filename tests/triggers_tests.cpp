@@ -433,6 +433,136 @@ TEST_CASE("and folding", "[trigger_tests]") {
 	}
 }
 
+TEST_CASE("constant folding", "[trigger_tests]") {
+	{
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope));
+		t.push_back(uint16_t(4));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+		t.push_back(uint16_t(0));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+
+		const auto new_size = parsers::simplify_trigger(t.data());
+
+		REQUIRE(2 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+		REQUIRE(t[1] == uint16_t(0));
+	}
+	{
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope));
+		t.push_back(uint16_t(4));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+		t.push_back(uint16_t(0));
+		t.push_back(uint16_t(trigger::association_ne | trigger::no_payload | trigger::always));
+
+		const auto new_size = parsers::simplify_trigger(t.data());
+
+		REQUIRE(1 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::association_ne | trigger::no_payload | trigger::always));
+	}
+	{
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope | trigger::is_disjunctive_scope));
+		t.push_back(uint16_t(3));
+		t.push_back(uint16_t(trigger::association_ne | trigger::no_payload | trigger::always));
+		t.push_back(uint16_t(trigger::association_ne | trigger::no_payload | trigger::always));
+
+		const auto new_size = parsers::simplify_trigger(t.data());
+
+		REQUIRE(1 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::association_ne | trigger::no_payload | trigger::always));
+	}
+}
+
+TEST_CASE("constant and scope inside or scope", "[trigger_tests]") {
+	{
+		// OR = { AND = { always = yes } owns = ... } is always true
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope | trigger::is_disjunctive_scope));
+		t.push_back(uint16_t(6));
+		t.push_back(uint16_t(trigger::generic_scope));
+		t.push_back(uint16_t(2));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+		t.push_back(uint16_t(0));
+
+		const auto new_size = parsers::simplify_trigger(t.data());
+
+		REQUIRE(1 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+	}
+	{
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope | trigger::is_disjunctive_scope));
+		t.push_back(uint16_t(7));
+		t.push_back(uint16_t(trigger::generic_scope));
+		t.push_back(uint16_t(3));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+		t.push_back(uint16_t(0));
+
+		const auto new_size = parsers::simplify_trigger(t.data());
+
+		REQUIRE(1 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+	}
+}
+
+TEST_CASE("conjunct deduplication and ordering", "[trigger_tests]") {
+	std::vector<uint16_t> t;
+	t.push_back(uint16_t(trigger::generic_scope));
+	t.push_back(uint16_t(10));
+	t.push_back(uint16_t(trigger::x_core_scope_nation));
+	t.push_back(uint16_t(4));
+	t.push_back(uint16_t(trigger::association_eq | trigger::blockade));
+	t.push_back(uint16_t(2));
+	t.push_back(uint16_t(1));
+	t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+	t.push_back(uint16_t(0));
+	t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+	t.push_back(uint16_t(0));
+
+	// simplification drops the repeat but keeps the authored order, which is what the tooltips show
+	const auto new_size = parsers::simplify_trigger(t.data());
+	t.resize(size_t(new_size));
+
+	REQUIRE(9 == new_size);
+	REQUIRE(t[0] == uint16_t(trigger::generic_scope));
+	REQUIRE(t[1] == uint16_t(8));
+	REQUIRE(t[2] == uint16_t(trigger::x_core_scope_nation));
+	REQUIRE(t[3] == uint16_t(4));
+	REQUIRE(t[4] == uint16_t(trigger::association_eq | trigger::blockade));
+	REQUIRE(t[5] == uint16_t(2));
+	REQUIRE(t[6] == uint16_t(1));
+	REQUIRE(t[7] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+	REQUIRE(t[8] == uint16_t(0));
+
+	// the committed evaluation copy tests the cheap member first
+	std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
+	auto const key = state->commit_trigger_data(t);
+	auto const start = state->trigger_data_indices[key.index() + 1];
+	REQUIRE(std::equal(t.begin(), t.end(), state->trigger_data.data() + start));
+	auto const e = state->trigger_evaluation_data.data() + start;
+	REQUIRE(e[0] == uint16_t(trigger::generic_scope));
+	REQUIRE(e[1] == uint16_t(8));
+	REQUIRE(e[2] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::owns));
+	REQUIRE(e[3] == uint16_t(0));
+	REQUIRE(e[4] == uint16_t(trigger::x_core_scope_nation));
+	REQUIRE(e[5] == uint16_t(4));
+	REQUIRE(e[6] == uint16_t(trigger::association_eq | trigger::blockade));
+	REQUIRE(e[7] == uint16_t(2));
+	REQUIRE(e[8] == uint16_t(1));
+
+	// the x_core member on its own can't share the storage of the scope above, as it sits elsewhere in the evaluation copy
+	std::vector<uint16_t> core_member(t.begin() + 2, t.begin() + 7);
+	auto const member_key = state->commit_trigger_data(core_member);
+	auto const member_start = state->trigger_data_indices[member_key.index() + 1];
+	REQUIRE(member_start >= start + 9);
+	REQUIRE(std::equal(core_member.begin(), core_member.end(), state->trigger_evaluation_data.data() + member_start));
+}
+
 TEST_CASE("effect scope absorbsion", "[effect_tests]") {
 	{
 		std::vector<uint16_t> t;
@@ -840,3 +970,91 @@ TEST_CASE("trigger payload translation", "[trigger_tests]") {
 		REQUIRE(new_d == dcon::nation_id{42});
 	}
 }
+
+void push_float_payload(std::vector<uint16_t>& data, float f) {
+	uint16_t parts[2];
+	std::memcpy(parts, &f, sizeof(f));
+	data.push_back(parts[0]);
+	data.push_back(parts[1]);
+}
+
+TEST_CASE("batched effects match scalar effects", "[effect_tests]") {
+	std::unique_ptr<sys::state> game_state_1 = load_testing_scenario_file();
+	std::unique_ptr<sys::state> game_state_2 = load_testing_scenario_file();
+	auto& batched = *game_state_1;
+	auto& scalar = *game_state_2;
+	batched.game_seed = scalar.game_seed = 808080;
+
+	// every_pop = { limit = { militancy < 5 } militancy = 3.5 consciousness = -1.25 money = -50 literacy = 0.3 }
+	std::vector<uint16_t> pop_limit_data{ uint16_t(trigger::militancy_pop | trigger::association_lt) };
+	push_float_payload(pop_limit_data, 5.0f);
+	std::vector<uint16_t> pop_effect_data{ uint16_t(effect::x_pop_scope_nation | effect::scope_has_limit), uint16_t(14), uint16_t(0) };
+	for(auto [code, amount] : { std::pair{ effect::militancy, 3.5f }, std::pair{ effect::consciousness, -1.25f },
+			std::pair{ effect::money, -50.0f }, std::pair{ effect::literacy, 0.3f } }) {
+		pop_effect_data.push_back(code);
+		push_float_payload(pop_effect_data, amount);
+	}
+	// every_country = { limit = { NOT = { is_vassal = yes } } treasury = -5000 }
+	std::vector<uint16_t> nation_limit_data{ uint16_t(trigger::is_vassal | trigger::association_ne | trigger::no_payload) };
+	std::vector<uint16_t> nation_effect_data{ uint16_t(effect::x_country_scope | effect::scope_has_limit), uint16_t(5), uint16_t(0), effect::treasury };
+	push_float_payload(nation_effect_data, -5000.0f);
+
+	auto const pop_limit = batched.commit_trigger_data(pop_limit_data);
+	auto const nation_limit = batched.commit_trigger_data(nation_limit_data);
+	REQUIRE(pop_limit == scalar.commit_trigger_data(pop_limit_data));
+	REQUIRE(nation_limit == scalar.commit_trigger_data(nation_limit_data));
+	pop_effect_data[2] = trigger::payload(pop_limit).value;
+	nation_effect_data[2] = trigger::payload(nation_limit).value;
+	auto const pop_effect = batched.commit_effect_data(pop_effect_data);
+	auto const nation_effect = batched.commit_effect_data(nation_effect_data);
+	REQUIRE(pop_effect == scalar.commit_effect_data(pop_effect_data));
+	REQUIRE(nation_effect == scalar.commit_effect_data(nation_effect_data));
+
+	auto effect_start = [](sys::state& ws, dcon::effect_key k) { return ws.effect_data.data() + ws.effect_data_indices[k.index() + 1]; };
+	REQUIRE(effect::is_batchable_pop_scope(batched, effect_start(batched, pop_effect)));
+	REQUIRE(effect::is_batchable_nation_scope(batched, effect_start(batched, nation_effect)));
+
+	// the scalar side walks the same objects one at a time, the way the scopes did before batching
+	auto apply_scalar_pop_effect = [&](dcon::nation_id n) {
+		auto tval = effect_start(scalar, pop_effect);
+		auto limit = trigger::payload(tval[2]).tr_id;
+		bool els = false;
+		for(auto p : scalar.world.nation_get_province_ownership(n)) {
+			for(auto pop : p.get_province().get_pop_location()) {
+				if(trigger::evaluate(scalar, limit, trigger::to_generic(pop.get_pop().id), trigger::to_generic(n), -1))
+					effect::apply_subeffects(tval, scalar, trigger::to_generic(pop.get_pop().id), trigger::to_generic(n), -1, 0, 0, els);
+			}
+		}
+	};
+	auto apply_scalar_nation_effect = [&]() {
+		auto tval = effect_start(scalar, nation_effect);
+		auto limit = trigger::payload(tval[2]).tr_id;
+		bool els = false;
+		for(auto n : scalar.world.in_nation) {
+			if(n.get_owned_province_count() != 0 && trigger::evaluate(scalar, limit, trigger::to_generic(n.id), -1, -1))
+				effect::apply_subeffects(tval, scalar, trigger::to_generic(n.id), -1, -1, 0, 0, els);
+		}
+	};
+
+	// twice over, so that the second round runs on pops that the clamps already moved
+	for(uint32_t round = 0; round < 2; ++round) {
+		for(auto n : batched.world.in_nation) {
+			if(n.get_owned_province_count() == 0)
+				continue;
+			effect::execute(batched, pop_effect, trigger::to_generic(n.id), trigger::to_generic(n.id), -1, 0, 0);
+			apply_scalar_pop_effect(n.id);
+		}
+		effect::execute(batched, nation_effect, -1, -1, -1, 0, 0);
+		apply_scalar_nation_effect();
+
+		for(auto p : batched.world.in_pop) {
+			REQUIRE(p.get_militancy() == scalar.world.pop_get_militancy(p));
+			REQUIRE(p.get_consciousness() == scalar.world.pop_get_consciousness(p));
+			REQUIRE(p.get_savings() == scalar.world.pop_get_savings(p));
+			REQUIRE(p.get_literacy() == scalar.world.pop_get_literacy(p));
+		}
+		for(auto n : batched.world.in_nation) {
+			REQUIRE(n.get_stockpiles(economy::money) == scalar.world.nation_get_stockpiles(n, economy::money));
+		}
+	}
+}